@@ -30,6 +30,11 @@ DEFINE_LOG_CATEGORY(LogSpatialActorChannel);
 DECLARE_CYCLE_STAT(TEXT("ReplicateActor"), STAT_SpatialActorChannelReplicateActor, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("UpdateSpatialPosition"), STAT_SpatialActorChannelUpdateSpatialPosition, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("ReplicateSubobject"), STAT_SpatialActorChannelReplicateSubobject, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("CompareReplicatedProperties"), STAT_SpatialActorChannelCompareReplicatedProperties, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("GetHandoverChangeList"), STAT_SpatialActorChannelGetHandoverChangeList, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Actors Diffed"), STAT_SpatialActorsDiffed, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Entities Created"), STAT_SpatialEntitiesCreated, STATGROUP_SpatialNet);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Entity Creation Latency (ms)"), STAT_SpatialEntityCreationLatency, STATGROUP_SpatialNet);
 
 namespace
 {
@@ -69,6 +74,42 @@ void UpdateChangelistHistory(TUniquePtr<FRepState>& RepState)
 	RepState->HistoryStart = RepState->HistoryStart % FRepState::MAX_CHANGE_HISTORY;
 	RepState->HistoryEnd = RepState->HistoryStart + NewHistoryCount;
 }
+
+bool IsSameMovement(const FRepMovement& A, const FRepMovement& B)
+{
+	return A.Location == B.Location
+		&& A.Rotation == B.Rotation
+		&& A.LinearVelocity == B.LinearVelocity
+		&& A.AngularVelocity == B.AngularVelocity
+		&& A.bSimulatedPhysicSleep == B.bSimulatedPhysicSleep
+		&& A.bRepPhysics == B.bRepPhysics;
+}
+
+bool UsesDirtyActorReplication(const UClass* Class)
+{
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	if (!SpatialGDKSettings->bUseDirtyActorReplication)
+	{
+		return false;
+	}
+
+	// Player controllers send their move acks and corrections from ReplicateActor, so they must be replicated every time.
+	if (Class->IsChildOf<APlayerController>())
+	{
+		return false;
+	}
+
+	for (const TSoftClassPtr<AActor>& DirtyClass : SpatialGDKSettings->DirtyActorReplicationClasses)
+	{
+		// A class that isn't loaded can't have any instances, so there is no need to load it.
+		if (DirtyClass.IsValid() && Class->IsChildOf(DirtyClass.Get()))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
 }
 
 USpatialActorChannel::USpatialActorChannel(const FObjectInitializer& ObjectInitializer /*= FObjectInitializer::Get()*/)
@@ -78,6 +119,11 @@ USpatialActorChannel::USpatialActorChannel(const FObjectInitializer& ObjectIniti
 	, EntityId(SpatialConstants::INVALID_ENTITY_ID)
 	, bInterestDirty(false)
 	, bIsListening(false)
+	, bDirtyReplicationEnabled(false)
+	, bReplicationDirty(true)
+	, LocationWhenLastReplicated(FVector::ZeroVector)
+	, MovementWhenLastReplicated()
+	, DeferredPriority(0)
 	, bNetOwned(false)
 	, NetDriver(nullptr)
 	, LastPositionSinceUpdate(FVector::ZeroVector)
@@ -165,6 +211,8 @@ bool USpatialActorChannel::CleanUp(const bool bForDestroy, EChannelCloseReason C
 	}
 #endif
 
+	Receiver->CleanupUnresolvedRefs(this);
+
 	// Must cleanup actor and subobjects before UActorChannel::Cleanup as it will clear CreateSubObjects
 	Receiver->CleanupDeletedEntity(EntityId);
 
@@ -315,6 +363,8 @@ int64 USpatialActorChannel::ReplicateActor()
 	bIsReplicatingActor = true;
 	FReplicationFlags RepFlags;
 
+	INC_DWORD_STAT(STAT_SpatialActorsDiffed);
+
 	// Send initial stuff.
 	if (bCreatingNewEntity)
 	{
@@ -508,9 +558,49 @@ int64 USpatialActorChannel::ReplicateActor()
 
 	bForceCompareProperties = false;		// Only do this once per frame when set
 
+	bReplicationDirty = false;
+	LocationWhenLastReplicated = Actor->GetActorLocation();
+	MovementWhenLastReplicated = Actor->ReplicatedMovement;
+	DeferredPriority = 0;
+
 	return (bWroteSomethingImportant) ? 1 : 0;	// TODO: return number of bits written (UNR-664)
 }
 
+void USpatialActorChannel::CompareReplicatedProperties()
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpatialActorChannelCompareReplicatedProperties);
+
+	// These must match the flags ReplicateActor uses for an entity that has already been created.
+	FReplicationFlags RepFlags;
+	RepFlags.bNetOwner = true;
+	RepFlags.bNetSimulated = (Actor->GetRemoteRole() == ROLE_SimulatedProxy);
+	RepFlags.bRepPhysics = Actor->ReplicatedMovement.bRepPhysics;
+	// The Spatial net driver is never a replay driver.
+	RepFlags.bReplay = false;
+
+	const uint32 ReplicationFrame = Connection->Driver->ReplicationFrame;
+
+	for (auto& ReplicatorPair : ReplicationMap)
+	{
+		FObjectReplicator& Replicator = ReplicatorPair.Value.Get();
+#if ENGINE_MINOR_VERSION <= 20
+		UObject* Object = ReplicatorPair.Key.Get();
+#else
+		UObject* Object = Replicator.GetWeakObjectPtr().Get();
+#endif
+		if (Object == nullptr || PendingDynamicSubobjects.Contains(Object))
+		{
+			continue;
+		}
+
+#if ENGINE_MINOR_VERSION <= 20
+		Replicator.ChangelistMgr->Update(Object, ReplicationFrame, Replicator.RepState->LastCompareIndex, RepFlags, bForceCompareProperties);
+#else
+		Replicator.ChangelistMgr->Update(Replicator.RepState.Get(), Object, ReplicationFrame, RepFlags, bForceCompareProperties);
+#endif
+	}
+}
+
 void USpatialActorChannel::DynamicallyAttachSubobject(UObject* Object)
 {
 	// Find out if this is a dynamic subobject or a subobject that is already attached but is now replicated
@@ -713,49 +803,61 @@ void USpatialActorChannel::InitializeHandoverShadowData(TArray<uint8>& ShadowDat
 {
 	const FClassInfo& ClassInfo = NetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(Object->GetClass());
 
-	uint32 Size = 0;
+	// The layout, including Unreal's alignment requirements, is worked out once per class, see FHandoverShadowSpan.
+	ShadowData.AddZeroed(ClassInfo.HandoverShadowDataSize);
 	for (const FHandoverPropertyInfo& PropertyInfo : ClassInfo.HandoverProperties)
 	{
 		if (PropertyInfo.ArrayIdx == 0) // For static arrays, the first element will handle the whole array
 		{
-			// Make sure we conform to Unreal's alignment requirements; this is matched below and in ReplicateActor()
-			Size = Align(Size, PropertyInfo.Property->GetMinAlignment());
-			Size += PropertyInfo.Property->GetSize();
-		}
-	}
-	ShadowData.AddZeroed(Size);
-	uint32 Offset = 0;
-	for (const FHandoverPropertyInfo& PropertyInfo : ClassInfo.HandoverProperties)
-	{
-		if (PropertyInfo.ArrayIdx == 0)
-		{
-			Offset = Align(Offset, PropertyInfo.Property->GetMinAlignment());
-			PropertyInfo.Property->InitializeValue(ShadowData.GetData() + Offset);
-			Offset += PropertyInfo.Property->GetSize();
+			PropertyInfo.Property->InitializeValue(ShadowData.GetData() + PropertyInfo.ShadowOffset);
 		}
 	}
 }
 
 FHandoverChangeState USpatialActorChannel::GetHandoverChangeList(TArray<uint8>& ShadowData, UObject* Object)
 {
+	SCOPE_CYCLE_COUNTER(STAT_SpatialActorChannelGetHandoverChangeList);
+
 	FHandoverChangeState HandoverChanged;
 
 	const FClassInfo& ClassInfo = NetDriver->ClassInfoManager->GetOrCreateClassInfoByClass(Object->GetClass());
 
-	uint32 ShadowDataOffset = 0;
-	for (const FHandoverPropertyInfo& PropertyInfo : ClassInfo.HandoverProperties)
+	for (const FHandoverShadowSpan& Span : ClassInfo.HandoverShadowSpans)
 	{
-		ShadowDataOffset = Align(ShadowDataOffset, PropertyInfo.Property->GetMinAlignment());
+		const uint8* Data = (uint8*)Object + Span.Offset;
+		uint8* StoredData = ShadowData.GetData() + Span.ShadowOffset;
+
+		if (!Span.bTriviallyComparable)
+		{
+			const FHandoverPropertyInfo& PropertyInfo = ClassInfo.HandoverProperties[Span.FirstProperty];
+
+			// Compare and assign.
+			if (bCreatingNewEntity || !PropertyInfo.Property->Identical(StoredData, Data))
+			{
+				HandoverChanged.Add(PropertyInfo.Handle);
+				PropertyInfo.Property->CopySingleValue(StoredData, Data);
+			}
+			continue;
+		}
+
+		// Usually nothing has changed, which one compare of the whole span finds out.
+		if (!bCreatingNewEntity && FMemory::Memcmp(StoredData, Data, Span.Size) == 0)
+		{
+			continue;
+		}
 
-		const uint8* Data = (uint8*)Object + PropertyInfo.Offset;
-		uint8* StoredData = ShadowData.GetData() + ShadowDataOffset;
-		// Compare and assign.
-		if (bCreatingNewEntity || !PropertyInfo.Property->Identical(StoredData, Data))
+		for (int32 PropertyIndex = Span.FirstProperty; PropertyIndex < Span.FirstProperty + Span.NumProperties; PropertyIndex++)
 		{
-			HandoverChanged.Add(PropertyInfo.Handle);
-			PropertyInfo.Property->CopySingleValue(StoredData, Data);
+			const FHandoverPropertyInfo& PropertyInfo = ClassInfo.HandoverProperties[PropertyIndex];
+			const int32 OffsetInSpan = PropertyInfo.ShadowOffset - Span.ShadowOffset;
+
+			if (bCreatingNewEntity || FMemory::Memcmp(StoredData + OffsetInSpan, Data + OffsetInSpan, PropertyInfo.Property->ElementSize) != 0)
+			{
+				HandoverChanged.Add(PropertyInfo.Handle);
+			}
 		}
-		ShadowDataOffset += PropertyInfo.Property->ElementSize;
+
+		FMemory::Memcpy(StoredData, Data, Span.Size);
 	}
 
 	return HandoverChanged;
@@ -806,6 +908,20 @@ void USpatialActorChannel::SetChannelActor(AActor* InActor)
 	}
 
 	SavedOwnerWorkerAttribute = SpatialGDK::GetOwnerWorkerAttribute(InActor);
+
+	bDirtyReplicationEnabled = UsesDirtyActorReplication(InActor->GetClass());
+}
+
+bool USpatialActorChannel::CanSkipReplication() const
+{
+	if (!bDirtyReplicationEnabled || bReplicationDirty || bInterestDirty || bCreatingNewEntity || Actor->GetTearOff())
+	{
+		return false;
+	}
+
+	// Movement is picked up without the Actor being marked dirty, so that moving Actors keep their SpatialOS position up to date.
+	// ReplicatedMovement was gathered by PreReplication when the consider list was built, and also changes with rotation and velocity.
+	return Actor->GetActorLocation() == LocationWhenLastReplicated && IsSameMovement(Actor->ReplicatedMovement, MovementWhenLastReplicated);
 }
 
 bool USpatialActorChannel::TryResolveActor()
@@ -890,7 +1006,13 @@ void USpatialActorChannel::OnCreateEntityResponse(const Worker_CreateEntityRespo
 	}
 
 	bCreatedEntity = true;
-	UE_LOG(LogSpatialActorChannel, Verbose, TEXT("Created entity (%lld) for: %s."), Op.entity_id, *Actor->GetName());
+
+	// Time from the actor being spawned, including any time the request spent queued, see FEntityCreationScheduler.
+	const float CreationLatencyMs = (Actor->GetWorld()->GetTimeSeconds() - Actor->CreationTime) * 1000.0f;
+	INC_DWORD_STAT(STAT_SpatialEntitiesCreated);
+	SET_FLOAT_STAT(STAT_SpatialEntityCreationLatency, CreationLatencyMs);
+
+	UE_LOG(LogSpatialActorChannel, Verbose, TEXT("Created entity (%lld) for: %s in %.1fms."), Op.entity_id, *Actor->GetName(), CreationLatencyMs);
 }
 
 void USpatialActorChannel::UpdateSpatialPosition()
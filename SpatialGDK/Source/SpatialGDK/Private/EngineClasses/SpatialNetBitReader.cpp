@@ -27,15 +27,16 @@ void FSpatialNetBitReader::DeserializeObjectRef(FUnrealObjectRef& ObjectRef)
 		FString Path;
 		*this << Path;
 
-		ObjectRef.Path = Path;
+		ObjectRef.SetPath(Path);
 	}
 
 	uint8 HasOuter;
 	SerializeBits(&HasOuter, 1);
 	if (HasOuter)
 	{
-		ObjectRef.Outer = FUnrealObjectRef();
-		DeserializeObjectRef(*ObjectRef.Outer);
+		FUnrealObjectRef Outer;
+		DeserializeObjectRef(Outer);
+		ObjectRef.SetOuter(Outer);
 	}
 }
 
@@ -21,6 +21,7 @@ DEFINE_LOG_CATEGORY(LogSpatialNetConnection);
 USpatialNetConnection::USpatialNetConnection(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, PlayerControllerEntity(SpatialConstants::INVALID_ENTITY_ID)
+	, HeartbeatTrackerSlot(INDEX_NONE)
 {
 	InternalAck = 1;
 }
@@ -135,7 +136,8 @@ void USpatialNetConnection::InitHeartbeat(FTimerManager* InTimerManager, Worker_
 
 	if (Driver->IsServer())
 	{
-		SetHeartbeatTimeoutTimer();
+		USpatialNetDriver* NetDriver = Cast<USpatialNetDriver>(Driver);
+		HeartbeatTrackerSlot = NetDriver->HeartbeatTracker.Add(this, NetDriver->Time);
 	}
 	else
 	{
@@ -143,18 +145,6 @@ void USpatialNetConnection::InitHeartbeat(FTimerManager* InTimerManager, Worker_
 	}
 }
 
-void USpatialNetConnection::SetHeartbeatTimeoutTimer()
-{
-	TimerManager->SetTimer(HeartbeatTimer, [WeakThis = TWeakObjectPtr<USpatialNetConnection>(this)]()
-	{
-		if (USpatialNetConnection* Connection = WeakThis.Get())
-		{
-			// This client timed out. Disconnect it and trigger OnDisconnected logic.
-			Connection->CleanUp();
-		}
-	}, GetDefault<USpatialGDKSettings>()->HeartbeatTimeoutSeconds, false);
-}
-
 void USpatialNetConnection::SetHeartbeatEventTimer()
 {
 	TimerManager->SetTimer(HeartbeatTimer, [WeakThis = TWeakObjectPtr<USpatialNetConnection>(this)]()
@@ -184,10 +174,21 @@ void USpatialNetConnection::DisableHeartbeat()
 	{
 		TimerManager->ClearTimer(HeartbeatTimer);
 	}
+
+	if (HeartbeatTrackerSlot != INDEX_NONE)
+	{
+		if (USpatialNetDriver* NetDriver = Cast<USpatialNetDriver>(Driver))
+		{
+			NetDriver->HeartbeatTracker.Remove(HeartbeatTrackerSlot, this);
+		}
+		HeartbeatTrackerSlot = INDEX_NONE;
+	}
+
 	PlayerControllerEntity = SpatialConstants::INVALID_ENTITY_ID;
 }
 
 void USpatialNetConnection::OnHeartbeat()
 {
-	SetHeartbeatTimeoutTimer();
+	USpatialNetDriver* NetDriver = Cast<USpatialNetDriver>(Driver);
+	NetDriver->HeartbeatTracker.RecordHeartbeat(HeartbeatTrackerSlot, this, NetDriver->Time);
 }
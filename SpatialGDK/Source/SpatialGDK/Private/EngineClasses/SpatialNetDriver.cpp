@@ -2,6 +2,7 @@
 
 #include "EngineClasses/SpatialNetDriver.h"
 
+#include "Async/ParallelFor.h"
 #include "Engine/ActorChannel.h"
 #include "Engine/ChildConnection.h"
 #include "Engine/Engine.h"
@@ -44,6 +45,13 @@
 DEFINE_LOG_CATEGORY(LogSpatialOSNetDriver);
 
 DECLARE_CYCLE_STAT(TEXT("ServerReplicateActors"), STAT_SpatialServerReplicateActors, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("PrioritizeActorsNearViewers"), STAT_SpatialPrioritizeActorsNearViewers, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("CompareReplicatedPropertiesInParallel"), STAT_SpatialCompareReplicatedPropertiesInParallel, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Actors Considered For Replication"), STAT_SpatialActorsConsidered, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Clean Actors Skipped"), STAT_SpatialCleanActorsSkipped, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Actors Sent"), STAT_SpatialActorsSent, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Actors Deferred"), STAT_SpatialActorsDeferred, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Replication Bytes Sent"), STAT_SpatialReplicationBytesSent, STATGROUP_SpatialNet);
 DEFINE_STAT(STAT_SpatialConsiderList);
 
 USpatialNetDriver::USpatialNetDriver(const FObjectInitializer& ObjectInitializer)
@@ -302,6 +310,7 @@ void USpatialNetDriver::CreateAndInitializeCoreClasses()
 
 	PackageMap = Cast<USpatialPackageMapClient>(GetSpatialOSNetConnection()->PackageMap);
 	PackageMap->Init(this);
+	SchemaScratch = MakeUnique<SpatialGDK::FSchemaScratch>(PackageMap);
 	Dispatcher->Init(this);
 	Sender->Init(this, &TimerManager);
 	Receiver->Init(this, &TimerManager);
@@ -364,7 +373,15 @@ void USpatialNetDriver::HandleOngoingServerTravel()
 	if (!ServerConnection && !SnapshotToLoad.IsEmpty() && Cast<USpatialGameInstance>(GetWorld()->GetGameInstance())->bResponsibleForSnapshotLoading)
 	{
 		UE_LOG(LogSpatialOSNetDriver, Log, TEXT("Worker authoriative over the GSM is loading snapshot: %s"), *SnapshotToLoad);
-		SnapshotManager->LoadSnapshot(SnapshotToLoad);
+		USnapshotManager::PostSnapshotLoadDelegate PostSnapshotLoad;
+		PostSnapshotLoad.BindLambda([SnapshotName = SnapshotToLoad](bool bSuccess)
+		{
+			if (!bSuccess)
+			{
+				UE_LOG(LogSpatialOSNetDriver, Error, TEXT("Failed to load snapshot '%s'. Entities created before the failure remain in the world and players won't be accepted."), *SnapshotName);
+			}
+		});
+		SnapshotManager->LoadSnapshot(SnapshotToLoad, PostSnapshotLoad);
 
 		// Once we've finished loading the snapshot we must update our bResponsibleForSnapshotLoading in-case we do not gain authority over the new GSM.
 		Cast<USpatialGameInstance>(GetWorld()->GetGameInstance())->bResponsibleForSnapshotLoading = false;
@@ -635,6 +652,11 @@ void USpatialNetDriver::NotifyActorDestroyed(AActor* ThisActor, bool IsSeamlessT
 	// Remove this actor from the network object list
 	GetNetworkObjectList().Remove(ThisActor);
 
+	if (RelevancyGrid.IsValid())
+	{
+		RelevancyGrid->Remove(ThisActor->GetUniqueID());
+	}
+
 	// Remove from renamed list if destroyed
 	RenamedStartupActors.Remove(ThisActor->GetFName());
 }
@@ -726,6 +748,41 @@ static FORCEINLINE_DEBUGGABLE bool ShouldActorGoDormant(AActor* Actor, const TAr
 	return true;
 }
 
+// Raises the priority of actors that were added to the relevancy grid in this pass, using only the viewers within each
+// actor's NetCullDistanceSquared. This matches the priority FActorPriority computes from all viewers, except that viewers
+// out of range only contribute the baseline set by GetOutOfRangePriority.
+static void PrioritizeActorsNearViewers(const FRelevancyGrid& RelevancyGrid, const TArray<FNetViewer>& ConnectionViewers, FActorPriority* PriorityList, const float MaxCullDistanceSquared, const float Time, const float SpawnPrioritySeconds, const bool bLowNetBandwidth)
+{
+	const float QueryRadius = FMath::Sqrt(MaxCullDistanceSquared);
+
+	for (const FNetViewer& Viewer : ConnectionViewers)
+	{
+		RelevancyGrid.ForEachInRadius(Viewer.ViewLocation, QueryRadius, [&](int32 PriorityIndex, const FVector& Location)
+		{
+			FActorPriority& ActorPriority = PriorityList[PriorityIndex];
+			AActor* Actor = ActorPriority.ActorInfo->Actor;
+
+			if (FVector::DistSquared(Location, Viewer.ViewLocation) > Actor->NetCullDistanceSquared)
+			{
+				return;
+			}
+
+			const float TimeSinceUpdate = ActorPriority.Channel ? (Time - ActorPriority.Channel->LastUpdateTime) : SpawnPrioritySeconds;
+			const float NetPriority = Actor->GetNetPriority(Viewer.ViewLocation, Viewer.ViewDir, Viewer.InViewer, Viewer.ViewTarget, ActorPriority.Channel, TimeSinceUpdate, bLowNetBandwidth);
+			ActorPriority.Priority = FMath::Max<int32>(ActorPriority.Priority, FMath::RoundToInt(65536.0f * NetPriority));
+		});
+	}
+}
+
+// Priority of an actor with no viewer in range: what AActor::GetNetPriority gives an actor out of view, which grows with
+// the time since its last update. Its state still has to reach the Runtime for other workers and for persistence, so
+// it must not stay at 0 and be starved by the ActorReplicationRateLimit.
+static int32 GetOutOfRangePriority(const AActor* Actor, const UActorChannel* Channel, const float Time, const float SpawnPrioritySeconds)
+{
+	const float TimeSinceUpdate = Channel ? (Time - Channel->LastUpdateTime) : SpawnPrioritySeconds;
+	return FMath::RoundToInt(65536.0f * Actor->NetPriority * TimeSinceUpdate);
+}
+
 int32 USpatialNetDriver::ServerReplicateActors_PrepConnections(const float DeltaSeconds)
 {
 	int32 NumClientsToTick = ClientConnections.Num();
@@ -793,6 +850,16 @@ int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection*
 		AGameNetworkManager* const NetworkManager = World->NetworkManager;
 		const bool bLowNetBandwidth = NetworkManager ? NetworkManager->IsInLowBandwidthMode() : false;
 
+		// With the relevancy grid, actors are prioritized against nearby viewers only, instead of against every viewer.
+		// Always relevant actors are few and should not be limited by distance, so they still consider every viewer.
+		const bool bUseRelevancyGrid = RelevancyGrid.IsValid() && ConnectionViewers.Num() > 0;
+		const TArray<FNetViewer> NoViewers;
+		float MaxCullDistanceSquared = 0.f;
+		if (bUseRelevancyGrid)
+		{
+			RelevancyGrid->BeginUpdate();
+		}
+
 		for (FNetworkObjectInfo* ActorInfo : ConsiderList)
 		{
 			AActor* Actor = ActorInfo->Actor;
@@ -833,7 +900,18 @@ int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection*
 
 				Actor->NetTag = NetTag;
 
-				OutPriorityList[FinalSortedCount] = FActorPriority(PriorityConnection, Channel, ActorInfo, ConnectionViewers, bLowNetBandwidth);
+				if (bUseRelevancyGrid && !Actor->bAlwaysRelevant)
+				{
+					// Priority is raised by PrioritizeActorsNearViewers once all actors are in the grid.
+					OutPriorityList[FinalSortedCount] = FActorPriority(PriorityConnection, Channel, ActorInfo, NoViewers, bLowNetBandwidth);
+					OutPriorityList[FinalSortedCount].Priority = GetOutOfRangePriority(Actor, Channel, Time, SpawnPrioritySeconds);
+					RelevancyGrid->Update(Actor->GetUniqueID(), Actor->GetActorLocation(), FinalSortedCount);
+					MaxCullDistanceSquared = FMath::Max(MaxCullDistanceSquared, Actor->NetCullDistanceSquared);
+				}
+				else
+				{
+					OutPriorityList[FinalSortedCount] = FActorPriority(PriorityConnection, Channel, ActorInfo, ConnectionViewers, bLowNetBandwidth);
+				}
 				OutPriorityActors[FinalSortedCount] = OutPriorityList + FinalSortedCount;
 
 				FinalSortedCount++;
@@ -845,6 +923,12 @@ int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection*
 			}
 		}
 
+		if (bUseRelevancyGrid)
+		{
+			SCOPE_CYCLE_COUNTER(STAT_SpatialPrioritizeActorsNearViewers);
+			PrioritizeActorsNearViewers(*RelevancyGrid, ConnectionViewers, OutPriorityList, MaxCullDistanceSquared, Time, SpawnPrioritySeconds, bLowNetBandwidth);
+		}
+
 		// Add in deleted actors
 		for (auto It = InConnection->GetDestroyedStartupOrDormantActorGUIDs().CreateIterator(); It; ++It)
 		{
@@ -855,6 +939,16 @@ int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection*
 			DeletedCount++;
 		}
 
+		// SpatialGDK - Actors that were deferred by the replication rate limit or byte budget keep the priority they accumulated
+		// while waiting, so that they eventually outrank Actors that are replicated every tick.
+		for (int32 j = 0; j < FinalSortedCount - DeletedCount; j++)
+		{
+			if (const USpatialActorChannel* SpatialChannel = Cast<USpatialActorChannel>(OutPriorityList[j].Channel))
+			{
+				OutPriorityList[j].Priority = static_cast<int32>(FMath::Min<int64>(static_cast<int64>(OutPriorityList[j].Priority) + SpatialChannel->GetDeferredPriority(), MAX_int32));
+			}
+		}
+
 		// Sort by priority
 		Sort(OutPriorityActors, FinalSortedCount, FCompareFActorPriority());
 	}
@@ -864,6 +958,49 @@ int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection*
 	return FinalSortedCount;
 }
 
+void USpatialNetDriver::CompareReplicatedPropertiesInParallel(FActorPriority** PriorityActors, const int32 FinalSortedCount, const int32 MaxActorsToReplicate)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpatialCompareReplicatedPropertiesInParallel);
+
+	// Gather, on the game thread, the existing channels ServerReplicateActors_ProcessPrioritizedActors is expected to
+	// replicate this frame. Anything that is not gathered here is compared as usual inside ReplicateActor.
+	TArray<USpatialActorChannel*> ChannelsToCompare;
+	ChannelsToCompare.Reserve(FMath::Min(FinalSortedCount, MaxActorsToReplicate));
+
+	for (int32 j = 0; j < FinalSortedCount && ChannelsToCompare.Num() < MaxActorsToReplicate; j++)
+	{
+		if (PriorityActors[j]->ActorInfo == nullptr)
+		{
+			continue;
+		}
+
+		USpatialActorChannel* Channel = Cast<USpatialActorChannel>(PriorityActors[j]->Channel);
+		if (Channel == nullptr || Channel->Actor == nullptr || Channel->Closing || Channel->bCreatingNewEntity || Channel->Actor->GetTearOff())
+		{
+			continue;
+		}
+
+		if (Channel->CanSkipReplication())
+		{
+			continue;
+		}
+
+		if (!Channel->IsReadyForReplication())
+		{
+			continue;
+		}
+
+		ChannelsToCompare.Add(Channel);
+	}
+
+	// Each channel only compares its own objects against its own shadow state. Component updates are still created and
+	// queued serially, in priority order, by ReplicateActor, so the outgoing messages are the same as without this.
+	ParallelFor(ChannelsToCompare.Num(), [&ChannelsToCompare](int32 Index)
+	{
+		ChannelsToCompare[Index]->CompareReplicatedProperties();
+	});
+}
+
 void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConnection* InConnection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated)
 {
 	// SpatialGDK - Here Unreal would check if the InConnection was saturated (!IsNetReady) and early out. Removed this as we do not currently use channel saturation.
@@ -881,6 +1018,15 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 	int32 MaxActorsToReplicate = (ActorReplicationRateLimit > 0) ? ActorReplicationRateLimit : INT32_MAX;
 	int32 FinalReplicatedCount = 0;
 
+	// SpatialGDK - Replication byte budget based on config value. Entity creation has its own limits and isn't counted.
+	const uint32 ReplicationBytesPerTick = GetDefault<USpatialGDKSettings>()->ReplicationBytesPerTick;
+	const uint64 ReplicationBytesAtStart = Sender->GetComponentUpdateBytes();
+
+	if (GetDefault<USpatialGDKSettings>()->bParallelPropertyComparison)
+	{
+		CompareReplicatedPropertiesInParallel(PriorityActors, FinalSortedCount, MaxActorsToReplicate);
+	}
+
 	for (int32 j = 0; j < FinalSortedCount; j++)
 	{
 		// Deletion entry
@@ -925,6 +1071,16 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 			AActor* Actor = PriorityActors[j]->ActorInfo->Actor;
 			bool bIsRelevant = false;
 
+			INC_DWORD_STAT(STAT_SpatialActorsConsidered);
+
+			// SpatialGDK - With dirty Actor replication, Actors that haven't changed since they were last replicated are skipped
+			// before their replicators are touched, and don't count towards the ActorReplicationRateLimit.
+			if (Channel != nullptr && Channel->CanSkipReplication())
+			{
+				INC_DWORD_STAT(STAT_SpatialCleanActorsSkipped);
+				continue;
+			}
+
 			// SpatialGDK: Here, Unreal would check (again) whether an actor is relevant. Removed such checks.
 			// only check visibility on already visible actors every 1.0 + 0.5R seconds
 			// bTearOff actors should never be checked
@@ -950,9 +1106,24 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 			// With throttling we no longer always replicate when RecentlyRelevant is true, thus we ensure to always replicate a TearOff actor while it still has a channel.
 			else if ((FinalReplicatedCount < MaxActorsToReplicate && !Actor->GetTearOff()) || (Actor->GetTearOff() && Channel != nullptr))
 			{
+				// SpatialGDK - Once the replication byte budget is spent, existing entities are deferred to a later tick. This is decided
+				// before taking a rate limit slot, so that Actors deferred by the budget don't use up slots other Actors could have had.
+				if (ReplicationBytesPerTick > 0 && Channel != nullptr && !Channel->bCreatingNewEntity && !Actor->GetTearOff()
+					&& Sender->GetComponentUpdateBytes() - ReplicationBytesAtStart >= ReplicationBytesPerTick)
+				{
+					Channel->DeferReplication(PriorityActors[j]->Priority);
+					INC_DWORD_STAT(STAT_SpatialActorsDeferred);
+					continue;
+				}
+
 				bIsRelevant = true;
 				FinalReplicatedCount++;
 			}
+			else if (Channel != nullptr && !Channel->bCreatingNewEntity)
+			{
+				Channel->DeferReplication(PriorityActors[j]->Priority);
+				INC_DWORD_STAT(STAT_SpatialActorsDeferred);
+			}
 
 			// If the actor is now relevant or was recently relevant.
 			const bool bIsRecentlyRelevant = bIsRelevant || (Channel && Time - Channel->RelevantTime < RelevantTimeout);
@@ -1004,6 +1175,7 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 
 						if (Channel->ReplicateActor())
 						{
+							INC_DWORD_STAT(STAT_SpatialActorsSent);
 							ActorUpdatesThisConnectionSent++;
 							if (DebugRelevantActors)
 							{
@@ -1048,6 +1220,8 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 		}
 	}
 
+	INC_DWORD_STAT_BY(STAT_SpatialReplicationBytesSent, Sender->GetComponentUpdateBytes() - ReplicationBytesAtStart);
+
 	// SpatialGDK - Here Unreal would return the position of the last replicated actor in PriorityActors before the channel became saturated.
 	// In Spatial we use ActorReplicationRateLimit and EntityCreationRateLimit to limit replication so this return value is not relevant.
 }
@@ -1170,6 +1344,16 @@ int32 USpatialNetDriver::ServerReplicateActors(float DeltaSeconds)
 		}
 	}
 
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	if (SpatialGDKSettings->bUseRelevancyGrid && !RelevancyGrid.IsValid())
+	{
+		RelevancyGrid = MakeUnique<FRelevancyGrid>(SpatialGDKSettings->RelevancyGridCellSize);
+	}
+	else if (!SpatialGDKSettings->bUseRelevancyGrid && RelevancyGrid.IsValid())
+	{
+		RelevancyGrid.Reset();
+	}
+
 	FMemMark RelevantActorMark(FMemStack::Get());
 
 	FActorPriority* PriorityList = NULL;
@@ -1214,6 +1398,11 @@ void USpatialNetDriver::TickDispatch(float DeltaTime)
 	// Not calling Super:: on purpose.
 	UNetDriver::TickDispatch(DeltaTime);
 
+	if (ClassInfoManager != nullptr)
+	{
+		ClassInfoManager->PollPrebuiltClassInfo();
+	}
+
 	if (Connection != nullptr)
 	{
 		TArray<Worker_OpList*> OpLists = Connection->GetOpList();
@@ -1366,6 +1555,21 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 #endif // WITH_SERVER_CODE
 	}
 
+	if (IsServer() && Sender != nullptr)
+	{
+		Sender->FlushCreateEntityRequests();
+
+		if (GetDefault<USpatialGDKSettings>()->bUsePositionStream)
+		{
+			Sender->FlushPositionStream();
+		}
+
+		if (SnapshotManager != nullptr)
+		{
+			SnapshotManager->FlushSnapshotLoad();
+		}
+	}
+
 	if (GetDefault<USpatialGDKSettings>()->bPackRPCs && Sender != nullptr)
 	{
 		Sender->FlushPackedRPCs();
@@ -1376,6 +1580,25 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 		TimerManager.Tick(DeltaTime);
 	}
 
+	if (IsServer())
+	{
+		HeartbeatTracker.Tick(Time, GetDefault<USpatialGDKSettings>()->HeartbeatTimeoutSeconds, [](USpatialNetConnection* TimedOutConnection)
+		{
+			// This client timed out. Disconnect it and trigger OnDisconnected logic.
+			TimedOutConnection->CleanUp();
+		});
+	}
+
+	if (Sender != nullptr)
+	{
+		Sender->FlushComponentUpdates();
+	}
+
+	if (SchemaScratch.IsValid())
+	{
+		SchemaScratch->EndFrame();
+	}
+
 	Super::TickFlush(DeltaTime);
 }
 
@@ -1684,6 +1907,26 @@ USpatialActorChannel* USpatialNetDriver::GetActorChannelByEntityId(Worker_Entity
 	return EntityToActorChannel.FindRef(EntityId);
 }
 
+void USpatialNetDriver::MarkActorDirty(UObject* Object)
+{
+	AActor* Actor = Cast<AActor>(Object);
+	if (Actor == nullptr)
+	{
+		Actor = Object->GetTypedOuter<AActor>();
+	}
+
+	if (Actor == nullptr || !IsServer())
+	{
+		return;
+	}
+
+	// Actors without a channel are replicated in full when their channel is created, so there is nothing to mark.
+	if (USpatialActorChannel* Channel = GetActorChannelByEntityId(PackageMap->GetEntityIdFromObject(Actor)))
+	{
+		Channel->MarkReplicationDirty();
+	}
+}
+
 USpatialActorChannel* USpatialNetDriver::CreateSpatialActorChannel(AActor* Actor, USpatialNetConnection* InConnection)
 {
 	if (InConnection == nullptr)
@@ -530,18 +530,18 @@ FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromUnrealObjectRefInternal(const F
 {
 	FNetworkGUID* CachedGUID = UnrealObjectRefToNetGUID.Find(ObjectRef);
 	FNetworkGUID NetGUID = CachedGUID ? *CachedGUID : FNetworkGUID{};
-	if (!NetGUID.IsValid() && ObjectRef.Path.IsSet())
+	if (!NetGUID.IsValid() && ObjectRef.HasPath())
 	{
 		FNetworkGUID OuterGUID;
 
 		// Recursively resolve the outers for this object in order to ensure that the package can be loaded
-		if (ObjectRef.Outer.IsSet())
+		if (ObjectRef.HasOuter())
 		{
-			OuterGUID = GetNetGUIDFromUnrealObjectRef(ObjectRef.Outer.GetValue());
+			OuterGUID = GetNetGUIDFromUnrealObjectRef(ObjectRef.GetOuter());
 		}
 
 		// Once all outer packages have been resolved, assign a new NetGUID for this object
-		NetGUID = RegisterNetGUIDFromPathForStaticObject(ObjectRef.Path.GetValue(), OuterGUID, ObjectRef.bNoLoadOnClient);
+		NetGUID = RegisterNetGUIDFromPathForStaticObject(ObjectRef.GetPath(), OuterGUID, ObjectRef.bNoLoadOnClient);
 		RegisterObjectRef(NetGUID, ObjectRef);
 	}
 	return NetGUID;
@@ -550,25 +550,21 @@ FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromUnrealObjectRefInternal(const F
 void FSpatialNetGUIDCache::NetworkRemapObjectRefPaths(FUnrealObjectRef& ObjectRef, bool bReading) const
 {
 	// If we have paths, network-sanitize all of them (e.g. removing PIE prefix).
-	if (!ObjectRef.Path.IsSet())
+	if (!ObjectRef.HasPath())
 	{
 		return;
 	}
 
-	FUnrealObjectRef* Iterator = &ObjectRef;
-	while (true)
+	FString TempPath(ObjectRef.GetPath());
+	GEngine->NetworkRemapPath(Driver, TempPath, bReading);
+	ObjectRef.SetPath(TempPath);
+
+	// Outers are interned, so they are remapped into a copy which is interned again.
+	if (ObjectRef.HasOuter())
 	{
-		if (Iterator->Path.IsSet())
-		{
-			FString TempPath(*Iterator->Path);
-			GEngine->NetworkRemapPath(Driver, TempPath, bReading);
-			Iterator->Path = TempPath;
-		}
-		if (!Iterator->Outer.IsSet())
-		{
-			break;
-		}
-		Iterator = &Iterator->Outer.GetValue();
+		FUnrealObjectRef Outer = ObjectRef.GetOuter();
+		NetworkRemapObjectRefPaths(Outer, bReading);
+		ObjectRef.SetOuter(Outer);
 	}
 }
 
@@ -0,0 +1,212 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/Connection/OutgoingMessageQueue.h"
+
+#include "Math/UnrealMathUtility.h"
+
+namespace SpatialGDK
+{
+
+namespace
+{
+
+template <typename T>
+void DestroyMessage(void* Storage)
+{
+	static_cast<T*>(Storage)->~T();
+}
+
+template <typename T>
+void MoveConstructMessage(void* Storage, void* OtherStorage)
+{
+	new (Storage) T(MoveTemp(*static_cast<T*>(OtherStorage)));
+}
+
+} // anonymous namespace
+
+FOutgoingMessageSlot::FOutgoingMessageSlot(FOutgoingMessageSlot&& Other)
+	: bIsSet(false)
+{
+	MoveFrom(Other);
+}
+
+FOutgoingMessageSlot& FOutgoingMessageSlot::operator=(FOutgoingMessageSlot&& Other)
+{
+	if (this != &Other)
+	{
+		Reset();
+		MoveFrom(Other);
+	}
+	return *this;
+}
+
+void FOutgoingMessageSlot::Reset()
+{
+	if (!bIsSet)
+	{
+		return;
+	}
+
+	switch (Get()->Type)
+	{
+	case EOutgoingMessageType::ReserveEntityIdsRequest:
+		DestroyMessage<FReserveEntityIdsRequest>(&Storage);
+		break;
+	case EOutgoingMessageType::CreateEntityRequest:
+		DestroyMessage<FCreateEntityRequest>(&Storage);
+		break;
+	case EOutgoingMessageType::DeleteEntityRequest:
+		DestroyMessage<FDeleteEntityRequest>(&Storage);
+		break;
+	case EOutgoingMessageType::AddComponent:
+		DestroyMessage<FAddComponent>(&Storage);
+		break;
+	case EOutgoingMessageType::RemoveComponent:
+		DestroyMessage<FRemoveComponent>(&Storage);
+		break;
+	case EOutgoingMessageType::ComponentUpdate:
+		DestroyMessage<FComponentUpdate>(&Storage);
+		break;
+	case EOutgoingMessageType::CommandRequest:
+		DestroyMessage<FCommandRequest>(&Storage);
+		break;
+	case EOutgoingMessageType::CommandResponse:
+		DestroyMessage<FCommandResponse>(&Storage);
+		break;
+	case EOutgoingMessageType::CommandFailure:
+		DestroyMessage<FCommandFailure>(&Storage);
+		break;
+	case EOutgoingMessageType::LogMessage:
+		DestroyMessage<FLogMessage>(&Storage);
+		break;
+	case EOutgoingMessageType::ComponentInterest:
+		DestroyMessage<FComponentInterest>(&Storage);
+		break;
+	case EOutgoingMessageType::EntityQueryRequest:
+		DestroyMessage<FEntityQueryRequest>(&Storage);
+		break;
+	case EOutgoingMessageType::Metrics:
+		DestroyMessage<FMetrics>(&Storage);
+		break;
+	default:
+		checkNoEntry();
+		break;
+	}
+
+	bIsSet = false;
+}
+
+void FOutgoingMessageSlot::MoveFrom(FOutgoingMessageSlot& Other)
+{
+	check(!bIsSet);
+
+	if (!Other.bIsSet)
+	{
+		return;
+	}
+
+	switch (Other.Get()->Type)
+	{
+	case EOutgoingMessageType::ReserveEntityIdsRequest:
+		MoveConstructMessage<FReserveEntityIdsRequest>(&Storage, &Other.Storage);
+		break;
+	case EOutgoingMessageType::CreateEntityRequest:
+		MoveConstructMessage<FCreateEntityRequest>(&Storage, &Other.Storage);
+		break;
+	case EOutgoingMessageType::DeleteEntityRequest:
+		MoveConstructMessage<FDeleteEntityRequest>(&Storage, &Other.Storage);
+		break;
+	case EOutgoingMessageType::AddComponent:
+		MoveConstructMessage<FAddComponent>(&Storage, &Other.Storage);
+		break;
+	case EOutgoingMessageType::RemoveComponent:
+		MoveConstructMessage<FRemoveComponent>(&Storage, &Other.Storage);
+		break;
+	case EOutgoingMessageType::ComponentUpdate:
+		MoveConstructMessage<FComponentUpdate>(&Storage, &Other.Storage);
+		break;
+	case EOutgoingMessageType::CommandRequest:
+		MoveConstructMessage<FCommandRequest>(&Storage, &Other.Storage);
+		break;
+	case EOutgoingMessageType::CommandResponse:
+		MoveConstructMessage<FCommandResponse>(&Storage, &Other.Storage);
+		break;
+	case EOutgoingMessageType::CommandFailure:
+		MoveConstructMessage<FCommandFailure>(&Storage, &Other.Storage);
+		break;
+	case EOutgoingMessageType::LogMessage:
+		MoveConstructMessage<FLogMessage>(&Storage, &Other.Storage);
+		break;
+	case EOutgoingMessageType::ComponentInterest:
+		MoveConstructMessage<FComponentInterest>(&Storage, &Other.Storage);
+		break;
+	case EOutgoingMessageType::EntityQueryRequest:
+		MoveConstructMessage<FEntityQueryRequest>(&Storage, &Other.Storage);
+		break;
+	case EOutgoingMessageType::Metrics:
+		MoveConstructMessage<FMetrics>(&Storage, &Other.Storage);
+		break;
+	default:
+		checkNoEntry();
+		return;
+	}
+
+	bIsSet = true;
+	Other.Reset();
+}
+
+FOutgoingMessageQueue::FOutgoingMessageQueue(uint32 InCapacity)
+	: Capacity(FMath::RoundUpToPowerOfTwo(FMath::Max(InCapacity, 2u)))
+	, IndexMask(Capacity - 1)
+	, Head(0)
+	, Tail(0)
+	, NumOverflowMessages(0)
+	, HighWaterMark(0)
+	, OverflowCount(0)
+{
+	Slots.SetNum(Capacity);
+}
+
+void FOutgoingMessageQueue::FlushOverflow()
+{
+	while (NumOverflowMessages > 0 && !IsFull())
+	{
+		const uint32 CurrentHead = Head.Load();
+		OverflowQueue.Dequeue(Slots[CurrentHead & IndexMask]);
+		Head.Store(CurrentHead + 1);
+		NumOverflowMessages--;
+	}
+}
+
+FOutgoingMessage* FOutgoingMessageQueue::Peek()
+{
+	const uint32 CurrentTail = Tail.Load();
+	if (CurrentTail == Head.Load())
+	{
+		return nullptr;
+	}
+
+	return Slots[CurrentTail & IndexMask].Get();
+}
+
+void FOutgoingMessageQueue::Pop()
+{
+	const uint32 CurrentTail = Tail.Load();
+	check(CurrentTail != Head.Load());
+
+	Slots[CurrentTail & IndexMask].Reset();
+	Tail.Store(CurrentTail + 1);
+}
+
+void FOutgoingMessageQueue::ResetCounters()
+{
+	HighWaterMark = Num() + NumOverflowMessages;
+	OverflowCount = 0;
+}
+
+void FOutgoingMessageQueue::UpdateHighWaterMark()
+{
+	HighWaterMark = FMath::Max(HighWaterMark, Num() + NumOverflowMessages);
+}
+
+} // namespace SpatialGDK
@@ -20,11 +20,19 @@
 
 DEFINE_LOG_CATEGORY(LogSpatialWorkerConnection);
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Outgoing Messages Sent"), STAT_SpatialOutgoingMessagesSent, STATGROUP_SpatialNet);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Outgoing Message Latency Avg (ms)"), STAT_SpatialOutgoingMessageLatencyAvg, STATGROUP_SpatialNet);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Outgoing Message Latency Max (ms)"), STAT_SpatialOutgoingMessageLatencyMax, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Outgoing Queue High Water Mark"), STAT_SpatialOutgoingQueueHighWaterMark, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Outgoing Queue Overflowed Messages"), STAT_SpatialOutgoingQueueOverflowCount, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("DecodeOpList"), STAT_SpatialDecodeOpList, STATGROUP_SpatialNet);
+
 using namespace SpatialGDK;
 
 void USpatialWorkerConnection::Init(USpatialGameInstance* InGameInstance)
 {
 	GameInstance = InGameInstance;
+	OutgoingMessagesQueue = MakeUnique<FOutgoingMessageQueue>(GetDefault<USpatialGDKSettings>()->OutgoingMessageQueueCapacity);
 }
 
 void USpatialWorkerConnection::FinishDestroy()
@@ -63,6 +71,8 @@ void USpatialWorkerConnection::DestroyConnection()
 		WorkerLocator = nullptr;
 	}
 
+	DecodedOpLists.Empty();
+
 	bIsConnected = false;
 	NextRequestId = 0;
 	KeepRunning.AtomicSet(true);
@@ -322,17 +332,29 @@ SpatialConnectionType USpatialWorkerConnection::GetConnectionType() const
 
 TArray<Worker_OpList*> USpatialWorkerConnection::GetOpList()
 {
+	PublishOutgoingMessageStats();
+
 	TArray<Worker_OpList*> OpLists;
-	while (!OpListQueue.IsEmpty())
+	FQueuedOpList QueuedOpList;
+	while (OpListQueue.Dequeue(QueuedOpList))
 	{
-		Worker_OpList* OutOpList;
-		OpListQueue.Dequeue(OutOpList);
-		OpLists.Add(OutOpList);
+		if (QueuedOpList.DecodedOps.IsValid())
+		{
+			DecodedOpLists.Add(QueuedOpList.OpList, MoveTemp(QueuedOpList.DecodedOps));
+		}
+		OpLists.Add(QueuedOpList.OpList);
 	}
 
 	return OpLists;
 }
 
+TUniquePtr<FDecodedOpList> USpatialWorkerConnection::TakeDecodedOpList(const Worker_OpList* OpList)
+{
+	TUniquePtr<FDecodedOpList> DecodedOps;
+	DecodedOpLists.RemoveAndCopyValue(OpList, DecodedOps);
+	return DecodedOps;
+}
+
 Worker_RequestId USpatialWorkerConnection::SendReserveEntityIdsRequest(uint32_t NumOfEntities)
 {
 	QueueOutgoingMessage<FReserveEntityIdsRequest>(NumOfEntities);
@@ -480,20 +502,38 @@ void USpatialWorkerConnection::OnConnectionFailure()
 
 bool USpatialWorkerConnection::Init()
 {
-	OpsUpdateInterval = 1.0f / GetDefault<USpatialGDKSettings>()->OpsUpdateRate;
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	OpsUpdateInterval = 1.0f / SpatialGDKSettings->OpsUpdateRate;
+	bWaitOnOpList = SpatialGDKSettings->bWakeOpsThreadOnDemand;
+	OpListTimeoutMs = SpatialGDKSettings->OpListTimeoutMs;
+	bPreDecodeComponentUpdates = SpatialGDKSettings->bPreDecodeComponentUpdates;
 
 	return true;
 }
 
 uint32 USpatialWorkerConnection::Run()
 {
-	while (KeepRunning)
+	if (bWaitOnOpList)
+	{
+		while (KeepRunning)
+		{
+			ProcessOutgoingMessages();
+
+			// Only wait on the connection when there is nothing left to send. GetOpList returns as soon as ops arrive,
+			// so the thread stays idle without traffic, but messages queued during the wait are sent once it returns.
+			QueueLatestOpList(OutgoingMessagesQueue->Num() == 0 ? OpListTimeoutMs : 0);
+		}
+	}
+	else
 	{
-		FPlatformProcess::Sleep(OpsUpdateInterval);
+		while (KeepRunning)
+		{
+			FPlatformProcess::Sleep(OpsUpdateInterval);
 
-		QueueLatestOpList();
+			QueueLatestOpList(0);
 
-		ProcessOutgoingMessages();
+			ProcessOutgoingMessages();
+		}
 	}
 
 	return 0;
@@ -512,12 +552,21 @@ void USpatialWorkerConnection::InitializeOpsProcessingThread()
 	check(OpsProcessingThread);
 }
 
-void USpatialWorkerConnection::QueueLatestOpList()
+void USpatialWorkerConnection::QueueLatestOpList(uint32 TimeoutMs)
 {
-	Worker_OpList* OpList = Worker_Connection_GetOpList(WorkerConnection, 0);
+	Worker_OpList* OpList = Worker_Connection_GetOpList(WorkerConnection, TimeoutMs);
 	if (OpList->op_count > 0)
 	{
-		OpListQueue.Enqueue(OpList);
+		FQueuedOpList QueuedOpList;
+		QueuedOpList.OpList = OpList;
+
+		if (bPreDecodeComponentUpdates)
+		{
+			SCOPE_CYCLE_COUNTER(STAT_SpatialDecodeOpList);
+			QueuedOpList.DecodedOps = MakeUnique<FDecodedOpList>(OpList);
+		}
+
+		OpListQueue.Enqueue(MoveTemp(QueuedOpList));
 	}
 	else
 	{
@@ -527,16 +576,13 @@ void USpatialWorkerConnection::QueueLatestOpList()
 
 void USpatialWorkerConnection::ProcessOutgoingMessages()
 {
-	while (!OutgoingMessagesQueue.IsEmpty())
+	while (FOutgoingMessage* OutgoingMessage = OutgoingMessagesQueue->Peek())
 	{
-		TUniquePtr<FOutgoingMessage> OutgoingMessage;
-		OutgoingMessagesQueue.Dequeue(OutgoingMessage);
-
 		switch (OutgoingMessage->Type)
 		{
 		case EOutgoingMessageType::ReserveEntityIdsRequest:
 		{
-			FReserveEntityIdsRequest* Message = static_cast<FReserveEntityIdsRequest*>(OutgoingMessage.Get());
+			FReserveEntityIdsRequest* Message = static_cast<FReserveEntityIdsRequest*>(OutgoingMessage);
 
 			Worker_Connection_SendReserveEntityIdsRequest(WorkerConnection,
 				Message->NumOfEntities,
@@ -545,7 +591,7 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::CreateEntityRequest:
 		{
-			FCreateEntityRequest* Message = static_cast<FCreateEntityRequest*>(OutgoingMessage.Get());
+			FCreateEntityRequest* Message = static_cast<FCreateEntityRequest*>(OutgoingMessage);
 
 			Worker_Connection_SendCreateEntityRequest(WorkerConnection,
 				Message->Components.Num(),
@@ -556,7 +602,7 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::DeleteEntityRequest:
 		{
-			FDeleteEntityRequest* Message = static_cast<FDeleteEntityRequest*>(OutgoingMessage.Get());
+			FDeleteEntityRequest* Message = static_cast<FDeleteEntityRequest*>(OutgoingMessage);
 
 			Worker_Connection_SendDeleteEntityRequest(WorkerConnection,
 				Message->EntityId,
@@ -565,7 +611,7 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::AddComponent:
 		{
-			FAddComponent* Message = static_cast<FAddComponent*>(OutgoingMessage.Get());
+			FAddComponent* Message = static_cast<FAddComponent*>(OutgoingMessage);
 
 			static const Worker_UpdateParameters DisableLoopback{ false /* loopback */ };
 			Worker_Connection_SendAddComponent(WorkerConnection,
@@ -576,7 +622,7 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::RemoveComponent:
 		{
-			FRemoveComponent* Message = static_cast<FRemoveComponent*>(OutgoingMessage.Get());
+			FRemoveComponent* Message = static_cast<FRemoveComponent*>(OutgoingMessage);
 
 			static const Worker_UpdateParameters DisableLoopback{ false /* loopback */ };
 			Worker_Connection_SendRemoveComponent(WorkerConnection,
@@ -587,7 +633,7 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::ComponentUpdate:
 		{
-			FComponentUpdate* Message = static_cast<FComponentUpdate*>(OutgoingMessage.Get());
+			FComponentUpdate* Message = static_cast<FComponentUpdate*>(OutgoingMessage);
 
 			static const Worker_UpdateParameters DisableLoopback{ false /* loopback */ };
 			Worker_Alpha_Connection_SendComponentUpdate(WorkerConnection,
@@ -598,7 +644,7 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::CommandRequest:
 		{
-			FCommandRequest* Message = static_cast<FCommandRequest*>(OutgoingMessage.Get());
+			FCommandRequest* Message = static_cast<FCommandRequest*>(OutgoingMessage);
 
 			static const Worker_CommandParameters DefaultCommandParams{};
 			Worker_Connection_SendCommandRequest(WorkerConnection,
@@ -611,7 +657,7 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::CommandResponse:
 		{
-			FCommandResponse* Message = static_cast<FCommandResponse*>(OutgoingMessage.Get());
+			FCommandResponse* Message = static_cast<FCommandResponse*>(OutgoingMessage);
 
 			Worker_Connection_SendCommandResponse(WorkerConnection,
 				Message->RequestId,
@@ -620,7 +666,7 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::CommandFailure:
 		{
-			FCommandFailure* Message = static_cast<FCommandFailure*>(OutgoingMessage.Get());
+			FCommandFailure* Message = static_cast<FCommandFailure*>(OutgoingMessage);
 
 			Worker_Connection_SendCommandFailure(WorkerConnection,
 				Message->RequestId,
@@ -629,7 +675,7 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::LogMessage:
 		{
-			FLogMessage* Message = static_cast<FLogMessage*>(OutgoingMessage.Get());
+			FLogMessage* Message = static_cast<FLogMessage*>(OutgoingMessage);
 
 			FTCHARToUTF8 LoggerName(*Message->LoggerName.ToString());
 			FTCHARToUTF8 LogString(*Message->Message);
@@ -643,7 +689,7 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::ComponentInterest:
 		{
-			FComponentInterest* Message = static_cast<FComponentInterest*>(OutgoingMessage.Get());
+			FComponentInterest* Message = static_cast<FComponentInterest*>(OutgoingMessage);
 
 			Worker_Connection_SendComponentInterest(WorkerConnection,
 				Message->EntityId,
@@ -653,7 +699,7 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::EntityQueryRequest:
 		{
-			FEntityQueryRequest* Message = static_cast<FEntityQueryRequest*>(OutgoingMessage.Get());
+			FEntityQueryRequest* Message = static_cast<FEntityQueryRequest*>(OutgoingMessage);
 
 			Worker_Connection_SendEntityQueryRequest(WorkerConnection,
 				&Message->EntityQuery,
@@ -662,7 +708,7 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 		}
 		case EOutgoingMessageType::Metrics:
 		{
-			FMetrics* Message = static_cast<FMetrics*>(OutgoingMessage.Get());
+			FMetrics* Message = static_cast<FMetrics*>(OutgoingMessage);
 
 			// Do the conversion here so we can store everything on the stack.
 			Worker_Metrics WorkerMetrics;
@@ -711,13 +757,50 @@ void USpatialWorkerConnection::ProcessOutgoingMessages()
 			break;
 		}
 		}
+
+		RecordOutgoingMessageLatency(FPlatformTime::Cycles64() - OutgoingMessage->QueuedTimeCycles);
+
+		OutgoingMessagesQueue->Pop();
 	}
 }
 
+void USpatialWorkerConnection::RecordOutgoingMessageLatency(uint64 LatencyCycles)
+{
+	FPlatformAtomics::InterlockedIncrement(&SentMessageCount);
+	FPlatformAtomics::InterlockedAdd(&SentMessageLatencyCycles, static_cast<int64>(LatencyCycles));
+
+	int64 CurrentMax = MaxSentMessageLatencyCycles;
+	while (static_cast<int64>(LatencyCycles) > CurrentMax)
+	{
+		const int64 PreviousMax = FPlatformAtomics::InterlockedCompareExchange(&MaxSentMessageLatencyCycles, static_cast<int64>(LatencyCycles), CurrentMax);
+		if (PreviousMax == CurrentMax)
+		{
+			break;
+		}
+		CurrentMax = PreviousMax;
+	}
+}
+
+void USpatialWorkerConnection::PublishOutgoingMessageStats()
+{
+	// Give messages that spilled over last frame a chance to move into the ring even if nothing else is queued this frame.
+	OutgoingMessagesQueue->FlushOverflow();
+
+	SET_DWORD_STAT(STAT_SpatialOutgoingQueueHighWaterMark, OutgoingMessagesQueue->GetHighWaterMark());
+	SET_DWORD_STAT(STAT_SpatialOutgoingQueueOverflowCount, OutgoingMessagesQueue->GetOverflowCount());
+	OutgoingMessagesQueue->ResetCounters();
+
+	const int64 MessageCount = FPlatformAtomics::InterlockedExchange(&SentMessageCount, 0);
+	const int64 LatencyCycles = FPlatformAtomics::InterlockedExchange(&SentMessageLatencyCycles, 0);
+	const int64 MaxLatencyCycles = FPlatformAtomics::InterlockedExchange(&MaxSentMessageLatencyCycles, 0);
+
+	SET_DWORD_STAT(STAT_SpatialOutgoingMessagesSent, MessageCount);
+	SET_FLOAT_STAT(STAT_SpatialOutgoingMessageLatencyAvg, MessageCount > 0 ? FPlatformTime::ToMilliseconds64(LatencyCycles) / MessageCount : 0.0);
+	SET_FLOAT_STAT(STAT_SpatialOutgoingMessageLatencyMax, FPlatformTime::ToMilliseconds64(MaxLatencyCycles));
+}
+
 template <typename T, typename... ArgsType>
 void USpatialWorkerConnection::QueueOutgoingMessage(ArgsType&&... Args)
 {
-	// TODO UNR-1271: As later optimization, we can change the queue to hold a union
-	// of all outgoing message types, rather than having a pointer.
-	OutgoingMessagesQueue.Enqueue(MakeUnique<T>(Forward<ArgsType>(Args)...));
+	OutgoingMessagesQueue->Enqueue<T>(Forward<ArgsType>(Args)...);
 }
@@ -0,0 +1,149 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/DecodedOps.h"
+
+#include "Async/ParallelFor.h"
+
+#include "SpatialConstants.h"
+#include "Utils/SchemaUtils.h"
+
+namespace
+{
+
+// Below this many decodable updates the overhead of fanning out to the task graph outweighs the gain.
+const int32 MinUpdatesForParallelDecode = 256;
+
+} // anonymous namespace
+
+namespace SpatialGDK
+{
+
+FDecodedRPCEvent::FDecodedRPCEvent(const Schema_Object* EventData, bool bPacked)
+	: Payload(EventData)
+	, PackedTargetEntityId(bPacked ? Schema_GetEntityId(EventData, SpatialConstants::UNREAL_PACKED_RPC_PAYLOAD_ENTITY_ID) : SpatialConstants::INVALID_ENTITY_ID)
+{
+}
+
+bool FDecodedOpList::IsDecodable(Worker_ComponentId ComponentId)
+{
+	switch (ComponentId)
+	{
+	case SpatialConstants::POSITION_COMPONENT_ID:
+	case SpatialConstants::ENTITY_ACL_COMPONENT_ID:
+	case SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID:
+	case SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID:
+	case SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID:
+	case SpatialConstants::HEARTBEAT_COMPONENT_ID:
+		return true;
+	default:
+		return false;
+	}
+}
+
+FDecodedOpList::FDecodedOpList(const Worker_OpList* InOpList)
+	: OpList(InOpList)
+{
+	UpdateIndexByOp.Init(INDEX_NONE, OpList->op_count);
+
+	TArray<const Worker_ComponentUpdate*> UpdatesToDecode;
+	for (uint32 i = 0; i < OpList->op_count; i++)
+	{
+		const Worker_Op& Op = OpList->ops[i];
+		if (Op.op_type == WORKER_OP_TYPE_COMPONENT_UPDATE && IsDecodable(Op.component_update.update.component_id))
+		{
+			UpdateIndexByOp[i] = UpdatesToDecode.Add(&Op.component_update.update);
+		}
+	}
+
+	Updates.SetNum(UpdatesToDecode.Num());
+
+	// Each update only reads its own schema object and writes its own slot, so they can be decoded independently.
+	ParallelFor(UpdatesToDecode.Num(), [this, &UpdatesToDecode](int32 Index)
+	{
+		DecodeComponentUpdate(*UpdatesToDecode[Index], Updates[Index]);
+	}, UpdatesToDecode.Num() < MinUpdatesForParallelDecode);
+}
+
+FDecodedComponentUpdate* FDecodedOpList::GetComponentUpdate(const Worker_Op* Op)
+{
+	const int32 OpIndex = static_cast<int32>(Op - OpList->ops);
+	if (!UpdateIndexByOp.IsValidIndex(OpIndex) || UpdateIndexByOp[OpIndex] == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	return &Updates[UpdateIndexByOp[OpIndex]];
+}
+
+void FDecodedOpList::DecodeComponentUpdate(const Worker_ComponentUpdate& Update, FDecodedComponentUpdate& OutDecoded)
+{
+	Schema_Object* FieldsObject = Schema_GetComponentUpdateFields(Update.schema_type);
+	Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(Update.schema_type);
+
+	switch (Update.component_id)
+	{
+	case SpatialConstants::POSITION_COMPONENT_ID:
+		if (Schema_GetObjectCount(FieldsObject, 1) > 0)
+		{
+			OutDecoded.Coords = GetCoordinateFromSchema(FieldsObject, 1);
+		}
+		break;
+	case SpatialConstants::ENTITY_ACL_COMPONENT_ID:
+	{
+		if (Schema_GetObjectCount(FieldsObject, 1) > 0)
+		{
+			OutDecoded.ReadAcl = GetWorkerRequirementSetFromSchema(FieldsObject, 1);
+		}
+
+		const uint32 KVPairCount = Schema_GetObjectCount(FieldsObject, 2);
+		if (KVPairCount > 0)
+		{
+			WriteAclMap ComponentWriteAcl;
+			for (uint32 i = 0; i < KVPairCount; i++)
+			{
+				Schema_Object* KVPairObject = Schema_IndexObject(FieldsObject, 2, i);
+				uint32 Key = Schema_GetUint32(KVPairObject, SCHEMA_MAP_KEY_FIELD_ID);
+				ComponentWriteAcl.Add(Key, GetWorkerRequirementSetFromSchema(KVPairObject, SCHEMA_MAP_VALUE_FIELD_ID));
+			}
+			OutDecoded.ComponentWriteAcl = MoveTemp(ComponentWriteAcl);
+		}
+		break;
+	}
+	case SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID:
+	case SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID:
+	case SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID:
+	{
+		if (Update.component_id != SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID && Schema_GetBoolCount(FieldsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_READY_ID) > 0)
+		{
+			OutDecoded.bRPCEndpointReady = GetBoolFromSchema(FieldsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_READY_ID);
+		}
+
+		const uint32 EventCount = Schema_GetObjectCount(EventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_EVENT_ID);
+		OutDecoded.RPCEvents.Reserve(EventCount);
+		for (uint32 i = 0; i < EventCount; i++)
+		{
+			OutDecoded.RPCEvents.Emplace(Schema_IndexObject(EventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_EVENT_ID, i), /* bPacked */ false);
+		}
+
+		// Packed RPCs only carry a target entity when sent through the client or server endpoints.
+		const bool bHasPackedTargets = Update.component_id != SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID;
+		const uint32 PackedEventCount = Schema_GetObjectCount(EventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_PACKED_EVENT_ID);
+		OutDecoded.PackedRPCEvents.Reserve(PackedEventCount);
+		for (uint32 i = 0; i < PackedEventCount; i++)
+		{
+			OutDecoded.PackedRPCEvents.Emplace(Schema_IndexObject(EventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_PACKED_EVENT_ID, i), bHasPackedTargets);
+		}
+		break;
+	}
+	case SpatialConstants::HEARTBEAT_COMPONENT_ID:
+		OutDecoded.HeartbeatEventCount = Schema_GetObjectCount(EventsObject, SpatialConstants::HEARTBEAT_EVENT_ID);
+		OutDecoded.bClientHasQuit = Schema_GetBoolCount(FieldsObject, SpatialConstants::HEARTBEAT_CLIENT_HAS_QUIT_ID) > 0 &&
+			GetBoolFromSchema(FieldsObject, SpatialConstants::HEARTBEAT_CLIENT_HAS_QUIT_ID);
+		break;
+	default:
+		checkNoEntry();
+		break;
+	}
+}
+
+} // namespace SpatialGDK
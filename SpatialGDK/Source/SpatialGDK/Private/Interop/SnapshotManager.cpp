@@ -2,17 +2,36 @@
 
 #include "Interop/SnapshotManager.h"
 
+#include "Async/Async.h"
+
 #include "EngineClasses/SpatialNetDriver.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "Interop/GlobalStateManager.h"
 #include "Interop/SpatialReceiver.h"
 #include "SpatialConstants.h"
+#include "SpatialGDKSettings.h"
 #include "Utils/SchemaUtils.h"
 
 DEFINE_LOG_CATEGORY(LogSnapshotManager);
 
+DECLARE_CYCLE_STAT(TEXT("SnapshotManager FlushSnapshotLoad"), STAT_SnapshotManagerFlushSnapshotLoad, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Snapshot Entities Pending"), STAT_SnapshotEntitiesPending, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Snapshot Entities Created"), STAT_SnapshotEntitiesCreated, STATGROUP_SpatialNet);
+
 using namespace SpatialGDK;
 
+namespace
+{
+// Most entity creation budget that can be saved up while waiting for ids, in seconds of budget.
+const double MaxBudgetSeconds = 0.25;
+
+// Least time between two progress messages while loading a snapshot or wiping the world.
+const double ProgressLogIntervalSeconds = 1.0;
+
+// Times the ids for a chunk of snapshot entities are requested before the load is given up.
+const int32 MaxReserveEntityIdsAttempts = 3;
+}
+
 void USnapshotManager::Init(USpatialNetDriver* InNetDriver)
 {
 	NetDriver = InNetDriver;
@@ -20,14 +39,22 @@ void USnapshotManager::Init(USpatialNetDriver* InNetDriver)
 	GlobalStateManager = InNetDriver->GlobalStateManager;
 }
 
-// WorldWipe will send out an expensive entity query for every entity in the deployment.
+// WorldWipe will send out an entity query for every entity in the deployment, asking for entity ids only.
 // It does this by having an entity query for all entities that are not the GSM (workaround for not having the ability to make a query for all entities).
-// Once it has the response to this query, it will send deletion requests for all found entities and then one for the GSM itself.
+// Once it has the response to this query, it will send deletion requests for all found entities in batches, and one for the GSM itself once they have all been deleted.
 // Should only be triggered by the worker which is authoritative over the GSM.
 void USnapshotManager::WorldWipe(const USpatialNetDriver::PostWorldWipeDelegate& PostWorldWipeDelegate)
 {
+	if (WorldWipeBatcher.IsValid())
+	{
+		UE_LOG(LogSnapshotManager, Error, TEXT("World wipe was triggered while a world wipe is already in progress."));
+		return;
+	}
+
 	UE_LOG(LogSnapshotManager, Log, TEXT("World wipe for deployment has been triggered. All entities will be deleted!"));
 
+	WorldWipeStartTime = FPlatformTime::Seconds();
+
 	Worker_Constraint GSMConstraint;
 	GSMConstraint.constraint_type = WORKER_CONSTRAINT_TYPE_ENTITY_ID;
 	GSMConstraint.entity_id_constraint.entity_id = GlobalStateManager->GlobalStateManagerEntityId;
@@ -39,9 +66,14 @@ void USnapshotManager::WorldWipe(const USpatialNetDriver::PostWorldWipeDelegate&
 	WorldConstraint.constraint_type = WORKER_CONSTRAINT_TYPE_NOT;
 	WorldConstraint.not_constraint = NotGSMConstraint;
 
+	// An empty list of components returns the entity ids without any component data.
+	Worker_ComponentId NoComponents = 0;
+
 	Worker_EntityQuery WorldQuery{};
 	WorldQuery.constraint = WorldConstraint;
 	WorldQuery.result_type = WORKER_RESULT_TYPE_SNAPSHOT;
+	WorldQuery.snapshot_result_type_component_id_count = 0;
+	WorldQuery.snapshot_result_type_component_ids = &NoComponents;
 
 	Worker_RequestId RequestID;
 	RequestID = NetDriver->Connection->SendEntityQueryRequest(&WorldQuery);
@@ -59,31 +91,101 @@ void USnapshotManager::WorldWipe(const USpatialNetDriver::PostWorldWipeDelegate&
 		}
 		else
 		{
-			// Send deletion requests for all entities found in the world entity query.
-			DeleteEntities(Op);
+			UE_LOG(LogSnapshotManager, Log, TEXT("World entity query returned %u entities in %.1fms."), Op.result_count, (FPlatformTime::Seconds() - WorldWipeStartTime) * 1000.0);
 
-			// Also make sure that we kill the GSM.
-			NetDriver->Connection->SendDeleteEntityRequest(GlobalStateManager->GlobalStateManagerEntityId);
+			// The world is ready to finish ServerTravel, which means loading in a new map, once every entity and the GSM have been deleted.
+			PostWorldWipe = PostWorldWipeDelegate;
 
-			// The world is now ready to finish ServerTravel which means loading in a new map.
-			PostWorldWipeDelegate.ExecuteIfBound();
+			// Send deletion requests for all entities found in the world entity query.
+			DeleteEntities(Op);
 		}
 	});
 
 	Receiver->AddEntityQueryDelegate(RequestID, WorldQueryDelegate);
 }
 
+// Deletes the entities in batches of at most WorldWipeMaxDeletesInFlight requests waiting for a response,
+// sending the next requests as responses arrive.
 void USnapshotManager::DeleteEntities(const Worker_EntityQueryResponseOp& Op)
 {
 	UE_LOG(LogSnapshotManager, Log, TEXT("Deleting %u entities."), Op.result_count);
 
+	TArray<Worker_EntityId> EntityIds;
+	EntityIds.Reserve(Op.result_count);
 	for (uint32_t i = 0; i < Op.result_count; i++)
 	{
-		UE_LOG(LogSnapshotManager, Verbose, TEXT("Sending delete request for: %i"), Op.results[i].entity_id);
-		NetDriver->Connection->SendDeleteEntityRequest(Op.results[i].entity_id);
+		EntityIds.Add(Op.results[i].entity_id);
+	}
+
+	WorldWipeBatcher = MakeUnique<FEntityDeleteBatcher>(MoveTemp(EntityIds), static_cast<int32>(GetDefault<USpatialGDKSettings>()->WorldWipeMaxDeletesInFlight));
+	LastWorldWipeProgressLogTime = FPlatformTime::Seconds();
+
+	SendWorldWipeDeletes();
+
+	// With nothing to delete no response will come, so the wipe has to finish here.
+	if (WorldWipeBatcher->IsDone())
+	{
+		FinishWorldWipe();
 	}
 }
 
+void USnapshotManager::SendWorldWipeDeletes()
+{
+	WorldWipeBatcher->SendRequests([this](Worker_EntityId EntityId)
+	{
+		UE_LOG(LogSnapshotManager, Verbose, TEXT("Sending delete request for: %lld"), EntityId);
+		Worker_RequestId RequestId = NetDriver->Connection->SendDeleteEntityRequest(EntityId);
+
+		DeleteEntityDelegate Delegate;
+		Delegate.BindUObject(this, &USnapshotManager::OnWorldWipeDeleteResponse);
+		Receiver->AddDeleteEntityDelegate(RequestId, Delegate);
+	});
+}
+
+void USnapshotManager::OnWorldWipeDeleteResponse(const Worker_DeleteEntityResponseOp& Op)
+{
+	if (!WorldWipeBatcher.IsValid())
+	{
+		return;
+	}
+
+	WorldWipeBatcher->OnDeleteResponse(Op.status_code == WORKER_STATUS_CODE_SUCCESS);
+
+	if (WorldWipeBatcher->IsDone())
+	{
+		FinishWorldWipe();
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now - LastWorldWipeProgressLogTime >= ProgressLogIntervalSeconds)
+	{
+		LastWorldWipeProgressLogTime = Now;
+		UE_LOG(LogSnapshotManager, Log, TEXT("World wipe progress: %d of %d entities deleted in %.1fs."), WorldWipeBatcher->GetNumDeleted(), WorldWipeBatcher->Num(), Now - WorldWipeStartTime);
+	}
+
+	SendWorldWipeDeletes();
+}
+
+void USnapshotManager::FinishWorldWipe()
+{
+	UE_LOG(LogSnapshotManager, Log, TEXT("World wipe deleted %d entities in %.1fs."), WorldWipeBatcher->GetNumDeleted(), FPlatformTime::Seconds() - WorldWipeStartTime);
+	if (WorldWipeBatcher->GetNumFailed() > 0)
+	{
+		UE_LOG(LogSnapshotManager, Warning, TEXT("World wipe failed to delete %d entities."), WorldWipeBatcher->GetNumFailed());
+	}
+
+	WorldWipeBatcher.Reset();
+
+	// Also make sure that we kill the GSM.
+	NetDriver->Connection->SendDeleteEntityRequest(GlobalStateManager->GlobalStateManagerEntityId);
+
+	// The world is now ready to finish ServerTravel which means loading in a new map.
+	USpatialNetDriver::PostWorldWipeDelegate Delegate = MoveTemp(PostWorldWipe);
+	PostWorldWipe.Unbind();
+	Delegate.ExecuteIfBound();
+}
+
 // GetSnapshotPath will take a snapshot (with or without the .snapshot extension) name and convert it to a relative path in the Game/Content folder.
 FString GetSnapshotPath(const FString& SnapshotName)
 {
@@ -99,9 +201,19 @@ FString GetSnapshotPath(const FString& SnapshotName)
 
 // LoadSnapshot will take a snapshot name which should be on disk and attempt to read and spawn all of the entities in that snapshot.
 // This should only be called from the worker which has authority over the GSM.
-void USnapshotManager::LoadSnapshot(const FString& SnapshotName)
+// The snapshot is streamed: entities are read in chunks on a background thread, ids are reserved per chunk, and the create
+// entity requests of one chunk are sent from FlushSnapshotLoad while the next chunk is read, so that only about two chunks
+// are held in memory at a time.
+void USnapshotManager::LoadSnapshot(const FString& SnapshotName, const PostSnapshotLoadDelegate& Delegate)
 {
-	FString SnapshotPath = GetSnapshotPath(SnapshotName);
+	if (bLoadingSnapshot)
+	{
+		UE_LOG(LogSnapshotManager, Error, TEXT("Can't load snapshot '%s' while snapshot '%s' is still loading."), *SnapshotName, *SnapshotPath);
+		Delegate.ExecuteIfBound(false);
+		return;
+	}
+
+	SnapshotPath = GetSnapshotPath(SnapshotName);
 
 	UE_LOG(LogSnapshotManager, Log, TEXT("Loading snapshot: '%s'"), *SnapshotPath);
 
@@ -116,28 +228,126 @@ void USnapshotManager::LoadSnapshot(const FString& SnapshotName)
 	{
 		UE_LOG(LogSnapshotManager, Error, TEXT("Error when attempting to read snapshot '%s': %s"), *SnapshotPath, *Error);
 		Worker_SnapshotInputStream_Destroy(Snapshot);
+		Delegate.ExecuteIfBound(false);
 		return;
 	}
 
-	TArray<TArray<Worker_ComponentData>> EntitiesToSpawn;
+	SnapshotStream = Snapshot;
+	PostSnapshotLoad = Delegate;
+	bLoadingSnapshot = true;
+	LoadStartTime = FPlatformTime::Seconds();
+	LastProgressLogTime = LoadStartTime;
+
+	ReadNextChunk();
+}
 
-	// Get all of the entities from the snapshot.
-	while (Worker_SnapshotInputStream_HasNext(Snapshot) > 0)
+void USnapshotManager::FlushSnapshotLoad()
+{
+	if (!bLoadingSnapshot)
 	{
-		Error = Worker_SnapshotInputStream_GetError(Snapshot);
-		if (!Error.IsEmpty())
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_SnapshotManagerFlushSnapshotLoad);
+
+	const double Now = FPlatformTime::Seconds();
+
+	if (ChunkFuture.IsValid() && ChunkFuture.IsReady())
+	{
+		// Moving the future out invalidates the member, so that the next chunk can be started.
+		TFuture<TSharedPtr<FSnapshotChunk>> Future = MoveTemp(ChunkFuture);
+		TSharedPtr<FSnapshotChunk> Chunk = Future.Get();
+
+		if (!Chunk->Error.IsEmpty())
 		{
-			UE_LOG(LogSnapshotManager, Error, TEXT("Error when reading snapshot. Aborting load snapshot: %s"), *Error);
-			Worker_SnapshotInputStream_Destroy(Snapshot);
+			UE_LOG(LogSnapshotManager, Error, TEXT("Error when reading snapshot. Aborting load snapshot after %d entities: %s"), NumEntitiesRead, *Chunk->Error);
+			DestroyEntities(Chunk->Entities);
+			FailLoadingSnapshot();
 			return;
 		}
 
-		const Worker_Entity* EntityToSpawn = Worker_SnapshotInputStream_ReadEntity(Snapshot);
+		if (Chunk->bEndOfSnapshot)
+		{
+			bSnapshotFullyRead = true;
+			Worker_SnapshotInputStream_Destroy(SnapshotStream);
+			SnapshotStream = nullptr;
+		}
+
+		NumEntitiesRead += Chunk->Entities.Num();
+		if (Chunk->Entities.Num() > 0)
+		{
+			ReserveEntityIds(Chunk);
+		}
+	}
+
+	// Only read ahead by one chunk, so that a rate limited load doesn't read the whole snapshot into memory.
+	if (!bSnapshotFullyRead && !ChunkFuture.IsValid() && GetNumEntitiesPending() <= static_cast<int32>(GetDefault<USpatialGDKSettings>()->SnapshotLoadChunkSize))
+	{
+		ReadNextChunk();
+	}
+
+	SendCreateEntityRequests(Now);
+
+	if (bSnapshotFullyRead && GetNumEntitiesPending() == 0)
+	{
+		FinishLoadingSnapshot(Now);
+	}
+	else if (Now - LastProgressLogTime >= ProgressLogIntervalSeconds)
+	{
+		LastProgressLogTime = Now;
+
+		const double Elapsed = Now - LoadStartTime;
+		UE_LOG(LogSnapshotManager, Log, TEXT("Snapshot load progress: %d entities read, %d created in %.1fs (%.0f entities/s)."),
+			NumEntitiesRead, NumEntitiesCreated, Elapsed, Elapsed > 0.0 ? NumEntitiesCreated / Elapsed : 0.0);
+	}
+}
 
-		Error = Worker_SnapshotInputStream_GetError(Snapshot);
-		if (Error.IsEmpty())
+void USnapshotManager::BeginDestroy()
+{
+	if (bLoadingSnapshot)
+	{
+		// Whoever is waiting for the load is being torn down too, so it isn't told.
+		PostSnapshotLoad.Unbind();
+		AbortLoadingSnapshot();
+	}
+
+	Super::BeginDestroy();
+}
+
+void USnapshotManager::ReadNextChunk()
+{
+	const int32 ChunkSize = FMath::Max(1, static_cast<int32>(GetDefault<USpatialGDKSettings>()->SnapshotLoadChunkSize));
+
+	// Nothing else touches the stream while the task is running, and the stream is only destroyed once the task has finished.
+	ChunkFuture = Async<TSharedPtr<FSnapshotChunk>>(EAsyncExecution::ThreadPool, [Snapshot = SnapshotStream, ChunkSize]()
+	{
+		TSharedPtr<FSnapshotChunk> Chunk = MakeShared<FSnapshotChunk>();
+		Chunk->Entities.Reserve(ChunkSize);
+
+		while (Chunk->Entities.Num() < ChunkSize)
 		{
+			if (Worker_SnapshotInputStream_HasNext(Snapshot) <= 0)
+			{
+				Chunk->bEndOfSnapshot = true;
+				break;
+			}
+
+			Chunk->Error = Worker_SnapshotInputStream_GetError(Snapshot);
+			if (!Chunk->Error.IsEmpty())
+			{
+				break;
+			}
+
+			const Worker_Entity* EntityToSpawn = Worker_SnapshotInputStream_ReadEntity(Snapshot);
+
+			Chunk->Error = Worker_SnapshotInputStream_GetError(Snapshot);
+			if (!Chunk->Error.IsEmpty())
+			{
+				break;
+			}
+
 			TArray<Worker_ComponentData> EntityComponents;
+			EntityComponents.Reserve(EntityToSpawn->component_count);
 			for (uint32_t i = 0; i < EntityToSpawn->component_count; ++i)
 			{
 				// Entity component data must be deep copied so that it can be used for CreateEntityRequest.
@@ -148,52 +358,64 @@ void USnapshotManager::LoadSnapshot(const FString& SnapshotName)
 				EntityComponents.Add(EntityComponentData);
 			}
 
-			EntitiesToSpawn.Add(EntityComponents);
-		}
-		else
-		{
-			UE_LOG(LogSnapshotManager, Error, TEXT("Error when reading snapshot. Aborting load snapshot: %s"), *Error);
-			Worker_SnapshotInputStream_Destroy(Snapshot);
-			return;
+			Chunk->Entities.Add(MoveTemp(EntityComponents));
 		}
-	}
 
-	Worker_SnapshotInputStream_Destroy(Snapshot);
+		return Chunk;
+	});
+}
 
-	// Set up reserve IDs delegate
-	ReserveEntityIDsDelegate SpawnEntitiesDelegate;
-	SpawnEntitiesDelegate.BindLambda([EntitiesToSpawn, this](const Worker_ReserveEntityIdsResponseOp& Op)
-	{
-		UE_LOG(LogSnapshotManager, Log, TEXT("Creating entities in snapshot, number of entities to spawn: %i"), Op.number_of_entity_ids);
+void USnapshotManager::ReserveEntityIds(const TSharedPtr<FSnapshotChunk>& Chunk)
+{
+	NumEntitiesReserving += Chunk->Entities.Num();
+	INC_DWORD_STAT_BY(STAT_SnapshotEntitiesPending, Chunk->Entities.Num());
 
-		// Ensure we have the same number of reserved IDs as we have entities to spawn
-		check(EntitiesToSpawn.Num() == Op.number_of_entity_ids);
+	SendReserveEntityIdsRequest(Chunk, 1);
+}
 
-		for (uint32_t i = 0; i < Op.number_of_entity_ids; i++)
+void USnapshotManager::SendReserveEntityIdsRequest(const TSharedPtr<FSnapshotChunk>& Chunk, int32 Attempt)
+{
+	// The delegate holds on to the chunk rather than copying it, and the component data is moved out when the ids arrive.
+	ReserveEntityIDsDelegate SpawnEntitiesDelegate;
+	SpawnEntitiesDelegate.BindLambda([this, Chunk, Attempt, LoadId = SnapshotLoadId](const Worker_ReserveEntityIdsResponseOp& Op)
+	{
+		if (LoadId != SnapshotLoadId)
 		{
-			// Get an entity to spawn and a reserved EntityID
-			TArray<Worker_ComponentData> EntityToSpawn = EntitiesToSpawn[i];
-			Worker_EntityId ReservedEntityID = Op.first_entity_id + i;
+			DestroyEntities(Chunk->Entities);
+			return;
+		}
 
-			// Check if this is the GSM
-			for (auto& ComponentData : EntityToSpawn)
+		if (Op.status_code != WORKER_STATUS_CODE_SUCCESS)
+		{
+			if (Attempt < MaxReserveEntityIdsAttempts)
 			{
-				if (ComponentData.component_id == SpatialConstants::SINGLETON_MANAGER_COMPONENT_ID)
-				{
-					// Save the new GSM Entity ID.
-					GlobalStateManager->GlobalStateManagerEntityId = ReservedEntityID;
-				}
+				UE_LOG(LogSnapshotManager, Warning, TEXT("Failed to reserve entity ids for %d snapshot entities: %s. Retrying..."), Chunk->Entities.Num(), UTF8_TO_TCHAR(Op.message));
+				SendReserveEntityIdsRequest(Chunk, Attempt + 1);
+				return;
 			}
 
-			UE_LOG(LogSnapshotManager, Log, TEXT("Sending entity create request for: %i"), ReservedEntityID);
-			NetDriver->Connection->SendCreateEntityRequest(MoveTemp(EntityToSpawn), &ReservedEntityID);
+			UE_LOG(LogSnapshotManager, Error, TEXT("Failed to reserve entity ids for %d snapshot entities after %d attempts: %s. Aborting load snapshot after %d entities created."),
+				Chunk->Entities.Num(), Attempt, UTF8_TO_TCHAR(Op.message), NumEntitiesCreated);
+			DestroyEntities(Chunk->Entities);
+			FailLoadingSnapshot();
+			return;
 		}
 
-		GlobalStateManager->SetAcceptingPlayers(true);
+		// Ensure we have the same number of reserved IDs as we have entities to spawn
+		check(Chunk->Entities.Num() == Op.number_of_entity_ids);
+
+		NumEntitiesReserving -= Chunk->Entities.Num();
+
+		EntitiesToCreate.Reserve(EntitiesToCreate.Num() + Chunk->Entities.Num());
+		for (int32 i = 0; i < Chunk->Entities.Num(); i++)
+		{
+			EntitiesToCreate.Add(FEntityToCreate{ Op.first_entity_id + i, MoveTemp(Chunk->Entities[i]) });
+		}
+		Chunk->Entities.Empty();
 	});
 
 	// Reserve the Entity IDs
-	Worker_RequestId ReserveRequestID = NetDriver->Connection->SendReserveEntityIdsRequest(EntitiesToSpawn.Num());
+	Worker_RequestId ReserveRequestID = NetDriver->Connection->SendReserveEntityIdsRequest(Chunk->Entities.Num());
 
 	// TODO: UNR-654
 	// References to entities that are stored within the snapshot need remapping once we know the new entity IDs.
@@ -201,3 +423,134 @@ void USnapshotManager::LoadSnapshot(const FString& SnapshotName)
 	// Add the spawn delegate
 	Receiver->AddReserveEntityIdsDelegate(ReserveRequestID, SpawnEntitiesDelegate);
 }
+
+void USnapshotManager::SendCreateEntityRequests(double Now)
+{
+	const uint32 EntitiesPerSecond = GetDefault<USpatialGDKSettings>()->SnapshotLoadEntitiesPerSecond;
+
+	// Budget saved up while waiting for ids is capped, so that a rate limited load doesn't send a burst once they arrive.
+	const double Elapsed = (LastFlushTime > 0.0) ? Now - LastFlushTime : MaxBudgetSeconds;
+	LastFlushTime = Now;
+	EntityBudget = FMath::Min(EntityBudget + Elapsed * EntitiesPerSecond, FMath::Max(1.0, EntitiesPerSecond * MaxBudgetSeconds));
+
+	const int32 FirstEntityToCreate = NextEntityToCreate;
+	for (; NextEntityToCreate < EntitiesToCreate.Num(); NextEntityToCreate++)
+	{
+		if (EntitiesPerSecond > 0)
+		{
+			if (EntityBudget < 1.0)
+			{
+				break;
+			}
+			EntityBudget -= 1.0;
+		}
+
+		FEntityToCreate& EntityToCreate = EntitiesToCreate[NextEntityToCreate];
+
+		// Check if this is the GSM
+		for (const Worker_ComponentData& ComponentData : EntityToCreate.Components)
+		{
+			if (ComponentData.component_id == SpatialConstants::SINGLETON_MANAGER_COMPONENT_ID)
+			{
+				// Save the new GSM Entity ID.
+				GlobalStateManager->GlobalStateManagerEntityId = EntityToCreate.EntityId;
+			}
+		}
+
+		UE_LOG(LogSnapshotManager, Verbose, TEXT("Sending entity create request for: %lld"), EntityToCreate.EntityId);
+		NetDriver->Connection->SendCreateEntityRequest(MoveTemp(EntityToCreate.Components), &EntityToCreate.EntityId);
+	}
+
+	const int32 NumSent = NextEntityToCreate - FirstEntityToCreate;
+	NumEntitiesCreated += NumSent;
+	DEC_DWORD_STAT_BY(STAT_SnapshotEntitiesPending, NumSent);
+	INC_DWORD_STAT_BY(STAT_SnapshotEntitiesCreated, NumSent);
+
+	// Sent entities are removed in bulk rather than one at a time.
+	if (NextEntityToCreate == EntitiesToCreate.Num() || NextEntityToCreate >= static_cast<int32>(GetDefault<USpatialGDKSettings>()->SnapshotLoadChunkSize))
+	{
+		EntitiesToCreate.RemoveAt(0, NextEntityToCreate, /* bAllowShrinking */ false);
+		NextEntityToCreate = 0;
+	}
+}
+
+int32 USnapshotManager::GetNumEntitiesPending() const
+{
+	return NumEntitiesReserving + EntitiesToCreate.Num() - NextEntityToCreate;
+}
+
+void USnapshotManager::FinishLoadingSnapshot(double Now)
+{
+	const double Elapsed = Now - LoadStartTime;
+	UE_LOG(LogSnapshotManager, Log, TEXT("Loaded snapshot '%s': created %d entities in %.1fs (%.0f entities/s)."),
+		*SnapshotPath, NumEntitiesCreated, Elapsed, Elapsed > 0.0 ? NumEntitiesCreated / Elapsed : 0.0);
+
+	PostSnapshotLoadDelegate Delegate = MoveTemp(PostSnapshotLoad);
+	PostSnapshotLoad.Unbind();
+	ResetSnapshotLoad();
+
+	GlobalStateManager->SetAcceptingPlayers(true);
+
+	Delegate.ExecuteIfBound(true);
+}
+
+void USnapshotManager::FailLoadingSnapshot()
+{
+	PostSnapshotLoadDelegate Delegate = MoveTemp(PostSnapshotLoad);
+	PostSnapshotLoad.Unbind();
+	AbortLoadingSnapshot();
+
+	Delegate.ExecuteIfBound(false);
+}
+
+void USnapshotManager::AbortLoadingSnapshot()
+{
+	if (ChunkFuture.IsValid())
+	{
+		TFuture<TSharedPtr<FSnapshotChunk>> Future = MoveTemp(ChunkFuture);
+		DestroyEntities(Future.Get()->Entities);
+	}
+
+	if (SnapshotStream != nullptr)
+	{
+		Worker_SnapshotInputStream_Destroy(SnapshotStream);
+		SnapshotStream = nullptr;
+	}
+
+	for (int32 i = NextEntityToCreate; i < EntitiesToCreate.Num(); i++)
+	{
+		for (Worker_ComponentData& ComponentData : EntitiesToCreate[i].Components)
+		{
+			Schema_DestroyComponentData(ComponentData.schema_type);
+		}
+	}
+	DEC_DWORD_STAT_BY(STAT_SnapshotEntitiesPending, GetNumEntitiesPending());
+
+	ResetSnapshotLoad();
+}
+
+void USnapshotManager::ResetSnapshotLoad()
+{
+	bLoadingSnapshot = false;
+	bSnapshotFullyRead = false;
+	SnapshotLoadId++;
+	EntitiesToCreate.Empty();
+	NextEntityToCreate = 0;
+	NumEntitiesReserving = 0;
+	NumEntitiesRead = 0;
+	NumEntitiesCreated = 0;
+	EntityBudget = 0.0;
+	LastFlushTime = 0.0;
+}
+
+void USnapshotManager::DestroyEntities(TArray<TArray<Worker_ComponentData>>& Entities)
+{
+	for (TArray<Worker_ComponentData>& Components : Entities)
+	{
+		for (Worker_ComponentData& ComponentData : Components)
+		{
+			Schema_DestroyComponentData(ComponentData.schema_type);
+		}
+	}
+	Entities.Empty();
+}
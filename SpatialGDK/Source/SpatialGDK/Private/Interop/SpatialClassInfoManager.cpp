@@ -3,6 +3,7 @@
 #include "Interop/SpatialClassInfoManager.h"
 
 #include "AssetRegistryModule.h"
+#include "Async/Async.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Engine/Engine.h"
 #include "GameFramework/Actor.h"
@@ -22,6 +23,12 @@
 
 DEFINE_LOG_CATEGORY(LogSpatialClassInfoManager);
 
+DECLARE_CYCLE_STAT(TEXT("CreateClassInfoForClass"), STAT_SpatialClassInfoManagerCreateClassInfo, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Class Info Built On Demand"), STAT_SpatialClassInfoBuiltOnDemand, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Class Info Prebuilt"), STAT_SpatialClassInfoPrebuilt, STATGROUP_SpatialNet);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Class Info Prebuild Time (ms)"), STAT_SpatialClassInfoPrebuildTime, STATGROUP_SpatialNet);
+DECLARE_MEMORY_STAT(TEXT("Class Info Memory"), STAT_SpatialClassInfoMemory, STATGROUP_SpatialNet);
+
 bool USpatialClassInfoManager::TryInit(USpatialNetDriver* InNetDriver, UActorGroupManager* InActorGroupManager)
 {
 	NetDriver = InNetDriver;
@@ -37,6 +44,11 @@ bool USpatialClassInfoManager::TryInit(USpatialNetDriver* InNetDriver, UActorGro
 		return false;
 	}
 
+	if (GetDefault<USpatialGDKSettings>()->bPrebuildClassInfo)
+	{
+		PrebuildClassInfo();
+	}
+
 	return true;
 }
 
@@ -88,25 +100,104 @@ ESchemaComponentType GetRPCType(UFunction* RemoteFunction)
 	return SCHEMA_Invalid;
 }
 
-void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
+// Uses the RPC names the schema generator saved for the class when they still match its functions, which in shipping builds
+// avoids walking and sorting every function of the class hierarchy.
+TArray<UFunction*> GetRPCFunctions(UClass* Class, const FClassInfoPrebuiltData* PrebuiltData)
 {
-	// Remove PIE prefix on class if it exists to properly look up the class.
-	FString ClassPath = Class->GetPathName();
-	GEngine->NetworkRemapPath(NetDriver, ClassPath, false);
+	if (PrebuiltData != nullptr)
+	{
+		TArray<UFunction*> RPCFunctions;
+		RPCFunctions.Reserve(PrebuiltData->RPCNames.Num());
 
-	TSharedRef<FClassInfo> Info = ClassInfoMap.Add(Class, MakeShared<FClassInfo>());
-	Info->Class = Class;
+		for (const FName& RPCName : PrebuiltData->RPCNames)
+		{
+			UFunction* RemoteFunction = Class->FindFunctionByName(RPCName);
+			if (RemoteFunction == nullptr)
+			{
+				break;
+			}
+			RPCFunctions.Add(RemoteFunction);
+		}
 
-	// Note: we have to add Class to ClassInfoMap before quitting, as it is expected to be in there by GetOrCreateClassInfoByClass. Therefore the quitting logic cannot be moved higher up.
-	if (!IsSupportedClass(ClassPath))
+		bool bPrebuiltRPCsMatch = RPCFunctions.Num() == PrebuiltData->RPCNames.Num();
+#if !UE_BUILD_SHIPPING
+		// Classes can change without schema being regenerated during development, so check against the class itself.
+		bPrebuiltRPCsMatch = bPrebuiltRPCsMatch && RPCFunctions == SpatialGDK::GetClassRPCFunctions(Class);
+#endif
+
+		if (bPrebuiltRPCsMatch)
+		{
+			return RPCFunctions;
+		}
+
+		UE_LOG(LogSpatialClassInfoManager, Warning, TEXT("The RPCs of class %s have changed since schema was generated. Regenerate schema to use its prebuilt class info."), *Class->GetPathName());
+	}
+
+	return SpatialGDK::GetClassRPCFunctions(Class);
+}
+
+// Whether comparing the bytes of two values of the property gives the same result as UProperty::Identical, apart from floats
+// where +0 and -0 compare as different and a NaN as equal to itself. Either only decides whether an update is sent.
+bool IsTriviallyComparable(const UProperty* Property)
+{
+	if (!Property->HasAnyPropertyFlags(CPF_IsPlainOldData))
 	{
-		UE_LOG(LogSpatialClassInfoManager, Error, TEXT("Could not find class %s in schema database. Double-check whether replication is enabled for this class, the class is explicitly referenced from the starting scene and schema has been generated."), *ClassPath);
-		UE_LOG(LogSpatialClassInfoManager, Error, TEXT("Disconnecting due to no generated schema for %s."), *ClassPath);
-		QuitGame();
-		return;
+		return false;
 	}
 
-	TArray<UFunction*> RelevantClassFunctions = SpatialGDK::GetClassRPCFunctions(Class);
+	// Bitfield bools share their byte with other properties.
+	if (const UBoolProperty* BoolProperty = Cast<UBoolProperty>(Property))
+	{
+		return BoolProperty->IsNativeBool();
+	}
+
+	if (const UStructProperty* StructProperty = Cast<UStructProperty>(Property))
+	{
+		return (StructProperty->Struct->StructFlags & STRUCT_IdenticalNative) == 0;
+	}
+
+	return true;
+}
+
+void BuildHandoverShadowLayout(FClassInfo& Info)
+{
+	int32 ShadowOffset = 0;
+	for (int32 i = 0; i < Info.HandoverProperties.Num(); i++)
+	{
+		FHandoverPropertyInfo& PropertyInfo = Info.HandoverProperties[i];
+		const int32 ElementSize = PropertyInfo.Property->ElementSize;
+
+		// Make sure we conform to Unreal's alignment requirements
+		ShadowOffset = Align(ShadowOffset, PropertyInfo.Property->GetMinAlignment());
+		PropertyInfo.ShadowOffset = ShadowOffset;
+		ShadowOffset += ElementSize;
+
+		const bool bTriviallyComparable = IsTriviallyComparable(PropertyInfo.Property);
+		if (bTriviallyComparable && Info.HandoverShadowSpans.Num() > 0)
+		{
+			FHandoverShadowSpan& LastSpan = Info.HandoverShadowSpans.Last();
+			if (LastSpan.bTriviallyComparable && LastSpan.Offset + LastSpan.Size == PropertyInfo.Offset && LastSpan.ShadowOffset + LastSpan.Size == PropertyInfo.ShadowOffset)
+			{
+				LastSpan.Size += ElementSize;
+				LastSpan.NumProperties++;
+				continue;
+			}
+		}
+
+		Info.HandoverShadowSpans.Add(FHandoverShadowSpan{ PropertyInfo.Offset, PropertyInfo.ShadowOffset, ElementSize, i, 1, bTriviallyComparable });
+	}
+
+	Info.HandoverShadowDataSize = ShadowOffset;
+}
+
+// Builds the parts of the class info that only depend on the class itself. Does not touch the class info manager, so that it can
+// run on a worker thread when prebuilding class info.
+TSharedRef<FClassInfo> BuildClassInfo(UClass* Class, const FClassInfoPrebuiltData* PrebuiltData, const bool bEnableHandover)
+{
+	TSharedRef<FClassInfo> Info = MakeShared<FClassInfo>();
+	Info->Class = Class;
+
+	TArray<UFunction*> RelevantClassFunctions = GetRPCFunctions(Class, PrebuiltData);
 
 	for (UFunction* RemoteFunction : RelevantClassFunctions)
 	{
@@ -123,8 +214,6 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 		Info->RPCInfoMap.Add(RemoteFunction, RPCInfo);
 	}
 
-	const bool bEnableHandover = GetDefault<USpatialGDKSettings>()->bEnableHandover;
-
 	for (TFieldIterator<UProperty> PropertyIt(Class); PropertyIt; ++PropertyIt)
 	{
 		UProperty* Property = *PropertyIt;
@@ -138,6 +227,7 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 				HandoverInfo.Offset = Property->GetOffset_ForGC() + Property->ElementSize * ArrayIdx;
 				HandoverInfo.ArrayIdx = ArrayIdx;
 				HandoverInfo.Property = Property;
+				HandoverInfo.ShadowOffset = 0; // Set by BuildHandoverShadowLayout
 
 				Info->HandoverProperties.Add(HandoverInfo);
 			}
@@ -156,6 +246,59 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 		}
 	}
 
+	BuildHandoverShadowLayout(Info.Get());
+
+	return Info;
+}
+
+SIZE_T GetAllocatedSize(const FClassInfo& Info)
+{
+	return sizeof(FClassInfo)
+		+ Info.RPCs.GetAllocatedSize()
+		+ Info.RPCInfoMap.GetAllocatedSize()
+		+ Info.HandoverProperties.GetAllocatedSize()
+		+ Info.HandoverShadowSpans.GetAllocatedSize()
+		+ Info.InterestProperties.GetAllocatedSize()
+		+ Info.SubobjectInfo.GetAllocatedSize()
+		+ Info.DynamicSubobjectInfo.GetAllocatedSize();
+}
+
+void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpatialClassInfoManagerCreateClassInfo);
+
+	// Remove PIE prefix on class if it exists to properly look up the class.
+	FString ClassPath = Class->GetPathName();
+	GEngine->NetworkRemapPath(NetDriver, ClassPath, false);
+
+	if (!IsSupportedClass(ClassPath))
+	{
+		// Note: we have to add Class to ClassInfoMap before quitting, as it is expected to be in there by GetOrCreateClassInfoByClass.
+		TSharedRef<FClassInfo> Info = ClassInfoMap.Add(Class, MakeShared<FClassInfo>());
+		Info->Class = Class;
+
+		UE_LOG(LogSpatialClassInfoManager, Error, TEXT("Could not find class %s in schema database. Double-check whether replication is enabled for this class, the class is explicitly referenced from the starting scene and schema has been generated."), *ClassPath);
+		UE_LOG(LogSpatialClassInfoManager, Error, TEXT("Disconnecting due to no generated schema for %s."), *ClassPath);
+		QuitGame();
+		return;
+	}
+
+	const FClassInfoPrebuiltData* PrebuiltData = SchemaDatabase->ClassPathToPrebuiltClassInfo.Find(ClassPath);
+	AddClassInfo(ClassPath, BuildClassInfo(Class, PrebuiltData, GetDefault<USpatialGDKSettings>()->bEnableHandover));
+
+	INC_DWORD_STAT(STAT_SpatialClassInfoBuiltOnDemand);
+}
+
+void USpatialClassInfoManager::AddClassInfo(const FString& ClassPath, TSharedRef<FClassInfo> Info)
+{
+	UClass* Class = Info->Class.Get();
+	check(Class != nullptr);
+
+	ClassInfoMap.Add(Class, Info);
+
+	// The class may derive from a class whose hierarchy is cached.
+	ClassHierarchyComponentIds.Reset();
+
 	if (Class->IsChildOf<AActor>())
 	{
 		FinishConstructingActorClassInfo(ClassPath, Info);
@@ -166,6 +309,135 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 	}
 }
 
+void USpatialClassInfoManager::PrebuildClassInfo()
+{
+	PrebuildStartTime = FPlatformTime::Seconds();
+
+	// Subobject classes go first, so that actor classes find the class info of their subobjects already built.
+	TArray<FString> ClassPaths;
+	SchemaDatabase->SubobjectClassPathToSchema.GenerateKeyArray(ClassPaths);
+	for (const auto& ActorSchemaData : SchemaDatabase->ActorClassPathToSchema)
+	{
+		ClassPaths.Add(ActorSchemaData.Key);
+	}
+
+	TArray<const FClassInfoPrebuiltData*> PrebuiltDatas;
+	for (const FString& ClassPath : ClassPaths)
+	{
+		// Classes nested in other assets, such as level blueprints, are loaded with their outer and built on demand.
+		if (ClassPath.Contains(SUBOBJECT_DELIMITER))
+		{
+			continue;
+		}
+
+		UClass* Class = FSoftClassPath(ClassPath).TryLoadClass<UObject>();
+		if (Class == nullptr)
+		{
+			UE_LOG(LogSpatialClassInfoManager, Warning, TEXT("Failed to load class %s when prebuilding class info."), *ClassPath);
+			continue;
+		}
+
+		PrebuiltClasses.Add(Class);
+		PrebuiltDatas.Add(SchemaDatabase->ClassPathToPrebuiltClassInfo.Find(ClassPath));
+	}
+
+	UE_LOG(LogSpatialClassInfoManager, Log, TEXT("Loaded %d classes for prebuilding class info in %.1fms."), PrebuiltClasses.Num(), (FPlatformTime::Seconds() - PrebuildStartTime) * 1000.0);
+
+	auto BuildAll = [Classes = PrebuiltClasses, PrebuiltDatas, bEnableHandover = GetDefault<USpatialGDKSettings>()->bEnableHandover]()
+	{
+		TArray<TSharedRef<FClassInfo>> Infos;
+		Infos.Reserve(Classes.Num());
+		for (int32 i = 0; i < Classes.Num(); i++)
+		{
+			Infos.Add(BuildClassInfo(Classes[i], PrebuiltDatas[i], bEnableHandover));
+		}
+		return Infos;
+	};
+
+	if (GetDefault<USpatialGDKSettings>()->bPrebuildClassInfoInBackground)
+	{
+		// The classes are kept alive by PrebuiltClasses and the SchemaDatabase isn't modified at runtime, so both can be read from the task.
+		PrebuiltClassInfoFuture = Async<TArray<TSharedRef<FClassInfo>>>(EAsyncExecution::ThreadPool, MoveTemp(BuildAll));
+	}
+	else
+	{
+		AddPrebuiltClassInfo(BuildAll());
+	}
+}
+
+void USpatialClassInfoManager::PollPrebuiltClassInfo()
+{
+	if (PrebuiltClassInfoFuture.IsValid() && PrebuiltClassInfoFuture.IsReady())
+	{
+		FinishPrebuildingClassInfo();
+	}
+}
+
+void USpatialClassInfoManager::FinishPrebuildingClassInfo()
+{
+	if (!PrebuiltClassInfoFuture.IsValid())
+	{
+		return;
+	}
+
+	// Moving the future out invalidates the member, so this only runs once.
+	TFuture<TArray<TSharedRef<FClassInfo>>> Future = MoveTemp(PrebuiltClassInfoFuture);
+	AddPrebuiltClassInfo(Future.Get());
+}
+
+void USpatialClassInfoManager::AddPrebuiltClassInfo(const TArray<TSharedRef<FClassInfo>>& PrebuiltInfos)
+{
+	for (const TSharedRef<FClassInfo>& Info : PrebuiltInfos)
+	{
+		UClass* Class = Info->Class.Get();
+		if (Class == nullptr || ClassInfoMap.Contains(Class))
+		{
+			continue;
+		}
+
+		FString ClassPath = Class->GetPathName();
+		GEngine->NetworkRemapPath(NetDriver, ClassPath, false);
+		AddClassInfo(ClassPath, Info);
+	}
+
+	const float PrebuildTimeMs = static_cast<float>((FPlatformTime::Seconds() - PrebuildStartTime) * 1000.0);
+	const SIZE_T AllocatedSize = GetClassInfoAllocatedSize();
+
+	SET_DWORD_STAT(STAT_SpatialClassInfoPrebuilt, PrebuiltInfos.Num());
+	SET_FLOAT_STAT(STAT_SpatialClassInfoPrebuildTime, PrebuildTimeMs);
+	SET_MEMORY_STAT(STAT_SpatialClassInfoMemory, AllocatedSize);
+
+	UE_LOG(LogSpatialClassInfoManager, Log, TEXT("Prebuilt class info for %d classes in %.1fms, allocating %.1fKB."), PrebuiltInfos.Num(), PrebuildTimeMs, AllocatedSize / 1024.0f);
+}
+
+SIZE_T USpatialClassInfoManager::GetClassInfoAllocatedSize() const
+{
+	SIZE_T AllocatedSize = ClassInfoMap.GetAllocatedSize() + ComponentToClassInfoMap.GetAllocatedSize() + ComponentToOffsetMap.GetAllocatedSize() + ComponentToCategoryMap.GetAllocatedSize();
+
+	// Subobject class info is shared between the maps, so only count each one once.
+	TSet<const FClassInfo*> CountedInfos;
+	auto CountInfo = [&AllocatedSize, &CountedInfos](const FClassInfo& Info)
+	{
+		bool bAlreadyCounted = false;
+		CountedInfos.Add(&Info, &bAlreadyCounted);
+		if (!bAlreadyCounted)
+		{
+			AllocatedSize += GetAllocatedSize(Info);
+		}
+	};
+
+	for (const auto& ClassInfoPair : ClassInfoMap)
+	{
+		CountInfo(ClassInfoPair.Value.Get());
+	}
+	for (const auto& ComponentInfoPair : ComponentToClassInfoMap)
+	{
+		CountInfo(ComponentInfoPair.Value.Get());
+	}
+
+	return AllocatedSize;
+}
+
 void USpatialClassInfoManager::FinishConstructingActorClassInfo(const FString& ClassPath, TSharedRef<FClassInfo>& Info)
 {
 	ForAllSchemaComponentTypes([&](ESchemaComponentType Type)
@@ -282,6 +554,8 @@ bool USpatialClassInfoManager::IsSupportedClass(const FString& PathName) const
 
 const FClassInfo& USpatialClassInfoManager::GetOrCreateClassInfoByClass(UClass* Class)
 {
+	FinishPrebuildingClassInfo();
+
 	if (!ClassInfoMap.Contains(Class))
 	{
 		CreateClassInfoForClass(Class);
@@ -292,6 +566,8 @@ const FClassInfo& USpatialClassInfoManager::GetOrCreateClassInfoByClass(UClass*
 
 const FClassInfo& USpatialClassInfoManager::GetOrCreateClassInfoByObject(UObject* Object)
 {
+	FinishPrebuildingClassInfo();
+
 	if (AActor* Actor = Cast<AActor>(Object))
 	{
 		return GetOrCreateClassInfoByClass(Actor->GetClass());
@@ -310,6 +586,8 @@ const FClassInfo& USpatialClassInfoManager::GetOrCreateClassInfoByObject(UObject
 
 const FClassInfo& USpatialClassInfoManager::GetClassInfoByComponentId(Worker_ComponentId ComponentId)
 {
+	FinishPrebuildingClassInfo();
+
 	if (!ComponentToClassInfoMap.Contains(ComponentId))
 	{
 		TryCreateClassInfoForComponentId(ComponentId);
@@ -321,6 +599,8 @@ const FClassInfo& USpatialClassInfoManager::GetClassInfoByComponentId(Worker_Com
 
 UClass* USpatialClassInfoManager::GetClassByComponentId(Worker_ComponentId ComponentId)
 {
+	FinishPrebuildingClassInfo();
+
 	TSharedRef<FClassInfo> Info = ComponentToClassInfoMap.FindChecked(ComponentId);
 	if (UClass* Class = Info->Class.Get())
 	{
@@ -356,6 +636,11 @@ TArray<Worker_ComponentId> USpatialClassInfoManager::GetComponentIdsForClassHier
 	check(SchemaDatabase);
 	if (bIncludeDerivedTypes)
 	{
+		if (const TArray<Worker_ComponentId>* CachedComponentIds = ClassHierarchyComponentIds.Find(&BaseClass))
+		{
+			return *CachedComponentIds;
+		}
+
 		for (TObjectIterator<UClass> It; It; ++It)
 		{
 			const UClass* Class = *It;
@@ -369,6 +654,8 @@ TArray<Worker_ComponentId> USpatialClassInfoManager::GetComponentIdsForClassHier
 				}
 			}
 		}
+
+		ClassHierarchyComponentIds.Add(&BaseClass, OutComponentIds);
 	}
 	else
 	{
@@ -386,6 +673,8 @@ TArray<Worker_ComponentId> USpatialClassInfoManager::GetComponentIdsForClassHier
 
 bool USpatialClassInfoManager::GetOffsetByComponentId(Worker_ComponentId ComponentId, uint32& OutOffset)
 {
+	FinishPrebuildingClassInfo();
+
 	if (!ComponentToOffsetMap.Contains(ComponentId))
 	{
 		TryCreateClassInfoForComponentId(ComponentId);
@@ -402,6 +691,8 @@ bool USpatialClassInfoManager::GetOffsetByComponentId(Worker_ComponentId Compone
 
 ESchemaComponentType USpatialClassInfoManager::GetCategoryByComponentId(Worker_ComponentId ComponentId)
 {
+	FinishPrebuildingClassInfo();
+
 	if (!ComponentToCategoryMap.Contains(ComponentId))
 	{
 		TryCreateClassInfoForComponentId(ComponentId);
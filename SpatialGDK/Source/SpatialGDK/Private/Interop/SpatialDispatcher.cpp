@@ -4,6 +4,8 @@
 
 #include "EngineClasses/SpatialNetConnection.h"
 #include "EngineClasses/SpatialNetDriver.h"
+#include "Interop/Connection/SpatialWorkerConnection.h"
+#include "Interop/DecodedOps.h"
 #include "Interop/SpatialReceiver.h"
 #include "Interop/SpatialStaticComponentView.h"
 #include "Interop/SpatialWorkerFlags.h"
@@ -13,6 +15,8 @@
 
 DEFINE_LOG_CATEGORY(LogSpatialView);
 
+DECLARE_CYCLE_STAT(TEXT("ProcessOps"), STAT_SpatialDispatcherProcessOps, STATGROUP_SpatialNet);
+
 void USpatialDispatcher::Init(USpatialNetDriver* InNetDriver)
 {
 	NetDriver = InNetDriver;
@@ -22,6 +26,17 @@ void USpatialDispatcher::Init(USpatialNetDriver* InNetDriver)
 
 void USpatialDispatcher::ProcessOps(Worker_OpList* OpList)
 {
+	SCOPE_CYCLE_COUNTER(STAT_SpatialDispatcherProcessOps);
+
+	// Component updates to well-known components may already have been decoded on the worker connection thread.
+	TUniquePtr<SpatialGDK::FDecodedOpList> DecodedOps;
+	if (NetDriver->Connection != nullptr)
+	{
+		DecodedOps = NetDriver->Connection->TakeDecodedOpList(OpList);
+	}
+
+	Receiver->BeginBatchingResolvedObjectRefs();
+
 	for (size_t i = 0; i < OpList->op_count; ++i)
 	{
 		Worker_Op* Op = &OpList->ops[i];
@@ -65,9 +80,12 @@ void USpatialDispatcher::ProcessOps(Worker_OpList* OpList)
 			Receiver->OnRemoveComponent(Op->remove_component);
 			break;
 		case WORKER_OP_TYPE_COMPONENT_UPDATE:
-			StaticComponentView->OnComponentUpdate(Op->component_update);
-			Receiver->OnComponentUpdate(Op->component_update);
+		{
+			SpatialGDK::FDecodedComponentUpdate* DecodedUpdate = DecodedOps.IsValid() ? DecodedOps->GetComponentUpdate(Op) : nullptr;
+			StaticComponentView->OnComponentUpdate(Op->component_update, DecodedUpdate);
+			Receiver->OnComponentUpdate(Op->component_update, DecodedUpdate);
 			break;
+		}
 
 		// Commands
 		case WORKER_OP_TYPE_COMMAND_REQUEST:
@@ -90,6 +108,7 @@ void USpatialDispatcher::ProcessOps(Worker_OpList* OpList)
 			Receiver->OnCreateEntityResponse(Op->create_entity_response);
 			break;
 		case WORKER_OP_TYPE_DELETE_ENTITY_RESPONSE:
+			Receiver->OnDeleteEntityResponse(Op->delete_entity_response);
 			break;
 		case WORKER_OP_TYPE_ENTITY_QUERY_RESPONSE:
 			Receiver->OnEntityQueryResponse(Op->entity_query_response);
@@ -113,6 +132,7 @@ void USpatialDispatcher::ProcessOps(Worker_OpList* OpList)
 		}
 	}
 
+	Receiver->FlushResolvedObjectRefs();
 	Receiver->FlushRemoveComponentOps();
 	Receiver->FlushRetryRPCs();
 }
@@ -14,6 +14,7 @@
 #include "EngineClasses/SpatialNetConnection.h"
 #include "EngineClasses/SpatialPackageMapClient.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
+#include "Interop/DecodedOps.h"
 #include "Interop/GlobalStateManager.h"
 #include "Interop/SpatialPlayerSpawner.h"
 #include "Interop/SpatialSender.h"
@@ -26,11 +27,16 @@
 #include "SpatialConstants.h"
 #include "Utils/ComponentReader.h"
 #include "Utils/ErrorCodeRemapping.h"
+#include "Utils/PositionStream.h"
 #include "Utils/RepLayoutUtils.h"
 #include "Utils/SpatialMetrics.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialReceiver);
 
+DECLARE_CYCLE_STAT(TEXT("Receiver ResolveIncomingOperations"), STAT_SpatialReceiverResolveIncomingOperations, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Unresolved Incoming Object Refs"), STAT_SpatialUnresolvedIncomingObjectRefs, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Streamed Positions Received"), STAT_SpatialStreamedPositionsReceived, STATGROUP_SpatialNet);
+
 using namespace SpatialGDK;
 
 void USpatialReceiver::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimerManager)
@@ -42,6 +48,10 @@ void USpatialReceiver::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTim
 	ClassInfoManager = InNetDriver->ClassInfoManager;
 	GlobalStateManager = InNetDriver->GlobalStateManager;
 	TimerManager = InTimerManager;
+
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	IncomingRPCs.SetQueueLimits(SCHEMA_ClientUnreliableRPC, SpatialGDKSettings->QueuedUnreliableRPCTimeToLive, SpatialGDKSettings->MaxQueuedUnreliableRPCsPerEntity);
+	IncomingRPCs.SetQueueLimits(SCHEMA_ServerUnreliableRPC, SpatialGDKSettings->QueuedUnreliableRPCTimeToLive, SpatialGDKSettings->MaxQueuedUnreliableRPCsPerEntity);
 }
 
 void USpatialReceiver::OnCriticalSection(bool InCriticalSection)
@@ -131,6 +141,9 @@ void USpatialReceiver::OnAddComponent(const Worker_AddComponentOp& Op)
 	case SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID:
 		GlobalStateManager->ApplyStartupActorManagerData(Op.data);
 		return;
+	case SpatialConstants::POSITION_STREAM_COMPONENT_ID:
+		ApplyPositionStream(Schema_GetComponentDataFields(Op.data.schema_type));
+		return;
 	case SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID:
 	case SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID:
 		Schema_Object* FieldsObject = Schema_GetComponentDataFields(Op.data.schema_type);
@@ -155,6 +168,9 @@ void USpatialReceiver::OnAddComponent(const Worker_AddComponentOp& Op)
 
 void USpatialReceiver::OnRemoveEntity(const Worker_RemoveEntityOp& Op)
 {
+	// RPCs waiting on the entity can't be applied once it's gone, and its blocked queues would never be unblocked.
+	IncomingRPCs.DropEntity(Op.entity_id);
+
 	RemoveActor(Op.entity_id);
 }
 
@@ -227,6 +243,12 @@ void USpatialReceiver::UpdateShadowData(Worker_EntityId EntityId)
 
 void USpatialReceiver::OnAuthorityChange(const Worker_AuthorityChangeOp& Op)
 {
+	if (Op.component_id == SpatialConstants::INTEREST_COMPONENT_ID && Op.authority == WORKER_AUTHORITY_NOT_AUTHORITATIVE)
+	{
+		// Another worker may change the Interest while we don't have authority, so the next update must be sent.
+		Sender->ForgetSentInterest(Op.entity_id);
+	}
+
 	if (bInCriticalSection)
 	{
 		PendingAuthorityChanges.Add(Op);
@@ -1032,23 +1054,23 @@ void USpatialReceiver::ApplyComponentData(UObject* TargetObject, USpatialActorCh
 			}
 		}
 
-		FObjectReferencesMap& ObjectReferencesMap = UnresolvedRefsMap.FindOrAdd(ChannelObjectPair);
+		FObjectReferencesMap& ObjectReferencesMap = GetUnresolvedRefsForUpdate(ChannelObjectPair);
 		TSet<FUnrealObjectRef> UnresolvedRefs;
 
 		ComponentReader Reader(NetDriver, ObjectReferencesMap, UnresolvedRefs);
 		Reader.ApplyComponentData(Data, TargetObject, Channel, /* bIsHandover */ false);
 
-		QueueIncomingRepUpdates(ChannelObjectPair, ObjectReferencesMap, UnresolvedRefs);
+		QueueIncomingRepUpdates(ChannelObjectPair, UnresolvedRefs);
 	}
 	else if (ComponentType == SCHEMA_Handover)
 	{
-		FObjectReferencesMap& ObjectReferencesMap = UnresolvedRefsMap.FindOrAdd(ChannelObjectPair);
+		FObjectReferencesMap& ObjectReferencesMap = GetUnresolvedRefsForUpdate(ChannelObjectPair);
 		TSet<FUnrealObjectRef> UnresolvedRefs;
 
 		ComponentReader Reader(NetDriver, ObjectReferencesMap, UnresolvedRefs);
 		Reader.ApplyComponentData(Data, TargetObject, Channel, /* bIsHandover */ true);
 
-		QueueIncomingRepUpdates(ChannelObjectPair, ObjectReferencesMap, UnresolvedRefs);
+		QueueIncomingRepUpdates(ChannelObjectPair, UnresolvedRefs);
 	}
 	else
 	{
@@ -1056,13 +1078,23 @@ void USpatialReceiver::ApplyComponentData(UObject* TargetObject, USpatialActorCh
 	}
 }
 
-void USpatialReceiver::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
+void USpatialReceiver::OnComponentUpdate(const Worker_ComponentUpdateOp& Op, FDecodedComponentUpdate* DecodedUpdate)
 {
 	if (Op.update.component_id == SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID ||
 		Op.update.component_id == SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID)
 	{
-		Schema_Object* FieldsObject = Schema_GetComponentUpdateFields(Op.update.schema_type);
-		RegisterListeningEntityIfReady(Op.entity_id, FieldsObject);
+		if (DecodedUpdate != nullptr)
+		{
+			if (DecodedUpdate->bRPCEndpointReady.IsSet())
+			{
+				RegisterListeningEntityIfReady(Op.entity_id, DecodedUpdate->bRPCEndpointReady.GetValue());
+			}
+		}
+		else
+		{
+			Schema_Object* FieldsObject = Schema_GetComponentUpdateFields(Op.update.schema_type);
+			RegisterListeningEntityIfReady(Op.entity_id, FieldsObject);
+		}
 	}
 
 	if (StaticComponentView->GetAuthority(Op.entity_id, Op.update.component_id) == WORKER_AUTHORITY_AUTHORITATIVE)
@@ -1094,7 +1126,7 @@ void USpatialReceiver::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
 #endif // WITH_EDITOR
 		return;
 	case SpatialConstants::HEARTBEAT_COMPONENT_ID:
-		OnHeartbeatComponentUpdate(Op);
+		OnHeartbeatComponentUpdate(Op, DecodedUpdate);
 		return;
 	case SpatialConstants::SINGLETON_MANAGER_COMPONENT_ID:
 		GlobalStateManager->ApplySingletonManagerUpdate(Op.update);
@@ -1106,10 +1138,13 @@ void USpatialReceiver::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
 	case SpatialConstants::STARTUP_ACTOR_MANAGER_COMPONENT_ID:
 		NetDriver->GlobalStateManager->ApplyStartupActorManagerUpdate(Op.update);
 		return;
+	case SpatialConstants::POSITION_STREAM_COMPONENT_ID:
+		ApplyPositionStream(Schema_GetComponentUpdateFields(Op.update.schema_type));
+		return;
 	case SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID:
 	case SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID:
 	case SpatialConstants::NETMULTICAST_RPCS_COMPONENT_ID:
-		HandleRPC(Op);
+		HandleRPC(Op, DecodedUpdate);
 		return;
 	}
 
@@ -1174,7 +1209,7 @@ void USpatialReceiver::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
 	}
 }
 
-void USpatialReceiver::HandleRPC(const Worker_ComponentUpdateOp& Op)
+void USpatialReceiver::HandleRPC(const Worker_ComponentUpdateOp& Op, FDecodedComponentUpdate* DecodedUpdate)
 {
 	Worker_EntityId EntityId = Op.entity_id;
 
@@ -1192,6 +1227,17 @@ void USpatialReceiver::HandleRPC(const Worker_ComponentUpdateOp& Op)
 		}
 	}
 
+	if (DecodedUpdate != nullptr)
+	{
+		ProcessDecodedRPCEvents(EntityId, Op, RPCEndpointComponentId, *DecodedUpdate, /* bPacked */ false);
+
+		if (GetDefault<USpatialGDKSettings>()->bPackRPCs)
+		{
+			ProcessDecodedRPCEvents(EntityId, Op, RPCEndpointComponentId, *DecodedUpdate, /* bPacked */ true);
+		}
+		return;
+	}
+
 	// Always process unpacked RPCs since some cannot be packed.
 	ProcessRPCEventField(EntityId, Op, RPCEndpointComponentId, /* bPacked */ false);
 
@@ -1212,7 +1258,8 @@ void USpatialReceiver::ProcessRPCEventField(Worker_EntityId EntityId, const Work
 	{
 		Schema_Object* EventData = Schema_IndexObject(EventsObject, EventId, i);
 
-		RPCPayload Payload(EventData);
+		// Reads the payload in place, it is only copied if the RPC has to be queued.
+		RPCPayloadView Payload(EventData);
 
 		FUnrealObjectRef ObjectRef(EntityId, Payload.Offset);
 
@@ -1235,27 +1282,71 @@ void USpatialReceiver::ProcessRPCEventField(Worker_EntityId EntityId, const Work
 			}
 		}
 
-		FPendingRPCParamsPtr Params = MakeUnique<FPendingRPCParams>(ObjectRef, MoveTemp(Payload));
-		if (UObject* TargetObject = PackageMap->GetObjectFromUnrealObjectRef(ObjectRef).Get())
+		if (!TryApplyRPCEvent(ObjectRef, Payload))
+		{
+			QueueIncomingRPC(MakeUnique<FPendingRPCParams>(ObjectRef, Payload.ToPayload()));
+		}
+	}
+}
+
+void USpatialReceiver::ProcessDecodedRPCEvents(Worker_EntityId EntityId, const Worker_ComponentUpdateOp& Op, Worker_ComponentId RPCEndpointComponentId, FDecodedComponentUpdate& DecodedUpdate, bool bPacked)
+{
+	TArray<FDecodedRPCEvent>& Events = bPacked ? DecodedUpdate.PackedRPCEvents : DecodedUpdate.RPCEvents;
+
+	for (FDecodedRPCEvent& Event : Events)
+	{
+		FUnrealObjectRef ObjectRef(EntityId, Event.Payload.Offset);
+
+		if (bPacked && Event.PackedTargetEntityId != SpatialConstants::INVALID_ENTITY_ID)
 		{
-			const FClassInfo& ClassInfo = ClassInfoManager->GetOrCreateClassInfoByObject(TargetObject);
-			UFunction* Function = ClassInfo.RPCs[Payload.Index];
-			const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(TargetObject, Function);
+			// See ProcessRPCEventField, packed RPCs carry their actual target entity.
+			ObjectRef.Entity = Event.PackedTargetEntityId;
 
-			if (!IncomingRPCs.ObjectHasRPCsQueuedOfType(ObjectRef.Entity, RPCInfo.Type))
+			if (StaticComponentView->GetAuthority(ObjectRef.Entity, RPCEndpointComponentId) != WORKER_AUTHORITY_AUTHORITATIVE)
 			{
-				// Apply if possible, queue otherwise
-				if (ApplyRPC(*Params))
-				{
-					continue;
-				}
+				continue;
 			}
 		}
 
-		QueueIncomingRPC(MoveTemp(Params));
+		ReceiveRPCEvent(ObjectRef, MoveTemp(Event.Payload));
+	}
+
+	Events.Empty();
+}
+
+void USpatialReceiver::ReceiveRPCEvent(const FUnrealObjectRef& ObjectRef, RPCPayload&& Payload)
+{
+	if (!TryApplyRPCEvent(ObjectRef, Payload))
+	{
+		QueueIncomingRPC(MakeUnique<FPendingRPCParams>(ObjectRef, MoveTemp(Payload)));
 	}
 }
 
+bool USpatialReceiver::TryApplyRPCEvent(const FUnrealObjectRef& ObjectRef, const RPCPayloadView& Payload)
+{
+	UObject* TargetObject = PackageMap->GetObjectFromUnrealObjectRef(ObjectRef).Get();
+	if (TargetObject == nullptr)
+	{
+		return false;
+	}
+
+	const FClassInfo& ClassInfo = ClassInfoManager->GetOrCreateClassInfoByObject(TargetObject);
+	UFunction* Function = ClassInfo.RPCs[Payload.Index];
+	if (Function == nullptr)
+	{
+		return false;
+	}
+
+	// RPCs of a type that already has RPCs queued for this entity are queued behind them, to keep them in order.
+	const FRPCInfo& RPCInfo = ClassInfoManager->GetRPCInfo(TargetObject, Function);
+	if (IncomingRPCs.ObjectHasRPCsQueuedOfType(ObjectRef.Entity, RPCInfo.Type))
+	{
+		return false;
+	}
+
+	return ApplyRPC(TargetObject, Function, Payload, FString{});
+}
+
 void USpatialReceiver::OnCommandRequest(const Worker_CommandRequestOp& Op)
 {
 	Schema_FieldId CommandIndex = Schema_GetCommandRequestCommandIndex(Op.request.schema_type);
@@ -1313,7 +1404,7 @@ void USpatialReceiver::OnCommandRequest(const Worker_CommandRequestOp& Op)
 
 	Schema_Object* RequestObject = Schema_GetCommandRequestObject(Op.request.schema_type);
 
-	RPCPayload Payload(RequestObject);
+	RPCPayloadView Payload(RequestObject);
 	FUnrealObjectRef ObjectRef = FUnrealObjectRef(Op.entity_id, Payload.Offset);
 	UObject* TargetObject = PackageMap->GetObjectFromUnrealObjectRef(ObjectRef).Get();
 	if (TargetObject == nullptr)
@@ -1341,7 +1432,7 @@ void USpatialReceiver::OnCommandRequest(const Worker_CommandRequestOp& Op)
 
 	if (!bAppliedRPC)
 	{
-		QueueIncomingRPC(MakeUnique<FPendingRPCParams>(ObjectRef, MoveTemp(Payload)));
+		QueueIncomingRPC(MakeUnique<FPendingRPCParams>(ObjectRef, Payload.ToPayload()));
 	}
 
 	Sender->SendEmptyCommandResponse(Op.request.component_id, CommandIndex, Op.request_id);
@@ -1425,7 +1516,7 @@ void USpatialReceiver::ApplyComponentUpdate(const Worker_ComponentUpdate& Compon
 {
 	FChannelObjectPair ChannelObjectPair(Channel, TargetObject);
 
-	FObjectReferencesMap& ObjectReferencesMap = UnresolvedRefsMap.FindOrAdd(ChannelObjectPair);
+	FObjectReferencesMap& ObjectReferencesMap = GetUnresolvedRefsForUpdate(ChannelObjectPair);
 	TSet<FUnrealObjectRef> UnresolvedRefs;
 	ComponentReader Reader(NetDriver, ObjectReferencesMap, UnresolvedRefs);
 	Reader.ApplyComponentUpdate(ComponentUpdate, TargetObject, Channel, bIsHandover);
@@ -1445,32 +1536,39 @@ void USpatialReceiver::ApplyComponentUpdate(const Worker_ComponentUpdate& Compon
 			Channel->ConditionalCleanUp(false, EChannelCloseReason::TearOff);
 #endif
 			CleanupDeletedEntity(Channel->GetEntityId());
+
+			// Cleaning up the channel dropped its unresolved refs.
+			return;
 		}
 	}
 
-	QueueIncomingRepUpdates(ChannelObjectPair, ObjectReferencesMap, UnresolvedRefs);
+	QueueIncomingRepUpdates(ChannelObjectPair, UnresolvedRefs);
 }
 
 void USpatialReceiver::RegisterListeningEntityIfReady(Worker_EntityId EntityId, Schema_Object* Object)
 {
 	if (Schema_GetBoolCount(Object, SpatialConstants::UNREAL_RPC_ENDPOINT_READY_ID) > 0)
 	{
-		bool bReady = GetBoolFromSchema(Object, SpatialConstants::UNREAL_RPC_ENDPOINT_READY_ID);
-		if (bReady)
+		RegisterListeningEntityIfReady(EntityId, GetBoolFromSchema(Object, SpatialConstants::UNREAL_RPC_ENDPOINT_READY_ID));
+	}
+}
+
+void USpatialReceiver::RegisterListeningEntityIfReady(Worker_EntityId EntityId, bool bReady)
+{
+	if (bReady)
+	{
+		if (USpatialActorChannel* Channel = NetDriver->GetActorChannelByEntityId(EntityId))
 		{
-			if (USpatialActorChannel* Channel = NetDriver->GetActorChannelByEntityId(EntityId))
+			Channel->StartListening();
+			if (UObject* TargetObject = Channel->GetActor())
 			{
-				Channel->StartListening();
-				if (UObject* TargetObject = Channel->GetActor())
-				{
-					Sender->SendOutgoingRPCs();
-				}
+				Sender->SendOutgoingRPCs();
 			}
 		}
 	}
 }
 
-bool USpatialReceiver::ApplyRPC(UObject* TargetObject, UFunction* Function, const RPCPayload& Payload, const FString& SenderWorkerId)
+bool USpatialReceiver::ApplyRPC(UObject* TargetObject, UFunction* Function, const RPCPayloadView& Payload, const FString& SenderWorkerId)
 {
 	bool bApplied = false;
 
@@ -1479,8 +1577,8 @@ bool USpatialReceiver::ApplyRPC(UObject* TargetObject, UFunction* Function, cons
 
 	TSet<FUnrealObjectRef> UnresolvedRefs;
 
-	RPCPayload PayloadCopy = Payload;
-	FSpatialNetBitReader PayloadReader(PackageMap, PayloadCopy.PayloadData.GetData(), PayloadCopy.CountDataBits(), UnresolvedRefs);
+	// The reader copies the payload into its own buffer, so it never writes to the memory the view points at.
+	FSpatialNetBitReader PayloadReader(PackageMap, const_cast<uint8*>(Payload.Data), Payload.CountDataBits(), UnresolvedRefs);
 
 	int ReliableRPCId = 0;
 	if (GetDefault<USpatialGDKSettings>()->bCheckRPCOrder)
@@ -1523,42 +1621,43 @@ bool USpatialReceiver::ApplyRPC(UObject* TargetObject, UFunction* Function, cons
 	return bApplied;
 }
 
-bool USpatialReceiver::ApplyRPC(const FPendingRPCParams& Params)
+EProcessRPCResult USpatialReceiver::ApplyQueuedRPC(const FPendingRPCParams& Params)
 {
 	TWeakObjectPtr<UObject> TargetObjectWeakPtr = PackageMap->GetObjectFromUnrealObjectRef(Params.ObjectRef);
 	if (!TargetObjectWeakPtr.IsValid())
 	{
-		return false;
+		// Retried once ResolvePendingOperations is called for the entity.
+		return EProcessRPCResult::TargetUnresolved;
 	}
 
 	const FClassInfo& ClassInfo = ClassInfoManager->GetOrCreateClassInfoByObject(TargetObjectWeakPtr.Get());
 	UFunction* Function = ClassInfo.RPCs[Params.Payload.Index];
 	if (Function == nullptr)
 	{
-		return false;
+		return EProcessRPCResult::Drop;
 	}
 
-	return ApplyRPC(TargetObjectWeakPtr.Get(), Function, Params.Payload, FString{});
+	return ApplyRPC(TargetObjectWeakPtr.Get(), Function, Params.Payload, FString{}) ? EProcessRPCResult::Processed : EProcessRPCResult::Retry;
 }
 
 void USpatialReceiver::OnReserveEntityIdsResponse(const Worker_ReserveEntityIdsResponseOp& Op)
 {
-	if (Op.status_code == WORKER_STATUS_CODE_SUCCESS)
+	if (Op.status_code != WORKER_STATUS_CODE_SUCCESS)
 	{
-		if (ReserveEntityIDsDelegate* RequestDelegate = ReserveEntityIDsDelegates.Find(Op.request_id))
-		{
-			UE_LOG(LogSpatialReceiver, Log, TEXT("Executing ReserveEntityIdsResponse with delegate, request id: %d, first entity id: %lld, message: %s"), Op.request_id, Op.first_entity_id, UTF8_TO_TCHAR(Op.message));
-			RequestDelegate->ExecuteIfBound(Op);
-			ReserveEntityIDsDelegates.Remove(Op.request_id);
-		}
-		else
-		{
-			UE_LOG(LogSpatialReceiver, Warning, TEXT("Recieved ReserveEntityIdsResponse but with no delegate set, request id: %d, first entity id: %lld, message: %s"), Op.request_id, Op.first_entity_id, UTF8_TO_TCHAR(Op.message));
-		}
+		UE_LOG(LogSpatialReceiver, Error, TEXT("Failed ReserveEntityIds: request id: %d, message: %s"), Op.request_id, UTF8_TO_TCHAR(Op.message));
 	}
-	else
+
+	// Delegates are also called on failure, so that they can retry or give up. The delegate is removed before it is called,
+	// since it may send another request and add a new delegate.
+	ReserveEntityIDsDelegate RequestDelegate;
+	if (ReserveEntityIDsDelegates.RemoveAndCopyValue(Op.request_id, RequestDelegate))
 	{
-		UE_LOG(LogSpatialReceiver, Error, TEXT("Failed ReserveEntityIds: request id: %d, message: %s"), Op.request_id, UTF8_TO_TCHAR(Op.message));
+		UE_LOG(LogSpatialReceiver, Log, TEXT("Executing ReserveEntityIdsResponse with delegate, request id: %d, first entity id: %lld, message: %s"), Op.request_id, Op.first_entity_id, UTF8_TO_TCHAR(Op.message));
+		RequestDelegate.ExecuteIfBound(Op);
+	}
+	else if (Op.status_code == WORKER_STATUS_CODE_SUCCESS)
+	{
+		UE_LOG(LogSpatialReceiver, Warning, TEXT("Recieved ReserveEntityIdsResponse but with no delegate set, request id: %d, first entity id: %lld, message: %s"), Op.request_id, Op.first_entity_id, UTF8_TO_TCHAR(Op.message));
 	}
 }
 
@@ -1591,6 +1690,20 @@ void USpatialReceiver::OnCreateEntityResponse(const Worker_CreateEntityResponseO
 	}
 }
 
+void USpatialReceiver::OnDeleteEntityResponse(const Worker_DeleteEntityResponseOp& Op)
+{
+	if (Op.status_code != WORKER_STATUS_CODE_SUCCESS)
+	{
+		UE_LOG(LogSpatialReceiver, Error, TEXT("Delete entity request failed: request id: %d, entity id: %lld, message: %s"), Op.request_id, Op.entity_id, UTF8_TO_TCHAR(Op.message));
+	}
+
+	DeleteEntityDelegate Delegate;
+	if (DeleteEntityDelegates.RemoveAndCopyValue(Op.request_id, Delegate))
+	{
+		Delegate.ExecuteIfBound(Op);
+	}
+}
+
 void USpatialReceiver::OnEntityQueryResponse(const Worker_EntityQueryResponseOp& Op)
 {
 	if (Op.status_code != WORKER_STATUS_CODE_SUCCESS)
@@ -1634,6 +1747,11 @@ void USpatialReceiver::AddCreateEntityDelegate(Worker_RequestId RequestId, const
 	CreateEntityDelegates.Add(RequestId, Delegate);
 }
 
+void USpatialReceiver::AddDeleteEntityDelegate(Worker_RequestId RequestId, const DeleteEntityDelegate& Delegate)
+{
+	DeleteEntityDelegates.Add(RequestId, Delegate);
+}
+
 TWeakObjectPtr<USpatialActorChannel> USpatialReceiver::PopPendingActorRequest(Worker_RequestId RequestId)
 {
 	TWeakObjectPtr<USpatialActorChannel>* ChannelPtr = PendingActorRequests.Find(RequestId);
@@ -1712,20 +1830,129 @@ void USpatialReceiver::OnDisconnect(Worker_DisconnectOp& Op)
 	}
 }
 
-void USpatialReceiver::QueueIncomingRepUpdates(FChannelObjectPair ChannelObjectPair, const FObjectReferencesMap& ObjectReferencesMap, const TSet<FUnrealObjectRef>& UnresolvedRefs)
+static void ForEachUnresolvedRef(const FObjectReferences& ObjectReferences, TFunctionRef<void(const FUnrealObjectRef&)> Function)
+{
+	if (ObjectReferences.Array)
+	{
+		for (const auto& ElementReferences : *ObjectReferences.Array)
+		{
+			ForEachUnresolvedRef(ElementReferences.Value, Function);
+		}
+		return;
+	}
+
+	for (const FUnrealObjectRef& UnresolvedRef : ObjectReferences.UnresolvedRefs)
+	{
+		Function(UnresolvedRef);
+	}
+}
+
+FObjectReferencesMap& USpatialReceiver::GetUnresolvedRefsForUpdate(const FChannelObjectPair& ChannelObjectPair)
 {
+	return UnresolvedRefsMap.FindOrAdd(ChannelObjectPair.Key).FindOrAdd(ChannelObjectPair.Value).ObjectReferencesMap;
+}
+
+FUnresolvedObjectRefs* USpatialReceiver::FindUnresolvedRefs(const FChannelObjectPair& ChannelObjectPair)
+{
+	if (TMap<TWeakObjectPtr<UObject>, FUnresolvedObjectRefs>* ChannelUnresolvedRefs = UnresolvedRefsMap.Find(ChannelObjectPair.Key))
+	{
+		return ChannelUnresolvedRefs->Find(ChannelObjectPair.Value);
+	}
+
+	return nullptr;
+}
+
+void USpatialReceiver::QueueIncomingRepUpdates(const FChannelObjectPair& ChannelObjectPair, const TSet<FUnrealObjectRef>& UnresolvedRefs)
+{
+	// Looked up again as applying the update can run RepNotifies that clean up the channel.
+	FUnresolvedObjectRefs* ObjectUnresolvedRefs = FindUnresolvedRefs(ChannelObjectPair);
+	if (ObjectUnresolvedRefs == nullptr)
+	{
+		return;
+	}
+
+	if (ObjectUnresolvedRefs->ObjectReferencesMap.Num() == 0)
+	{
+		RemoveUnresolvedRefs(ChannelObjectPair);
+		return;
+	}
+
+	if (UnresolvedRefs.Num() == 0)
+	{
+		return;
+	}
+
+	// Index the properties holding the refs this update couldn't resolve by their offset, so that resolving a ref only
+	// has to look at the properties that reference it.
+	for (const auto& OffsetAndReferences : ObjectUnresolvedRefs->ObjectReferencesMap)
+	{
+		ForEachUnresolvedRef(OffsetAndReferences.Value, [&](const FUnrealObjectRef& UnresolvedRef)
+		{
+			if (UnresolvedRefs.Contains(UnresolvedRef))
+			{
+				IncomingRefsMap.FindOrAdd(UnresolvedRef).FindOrAdd(ChannelObjectPair).Add(OffsetAndReferences.Key);
+			}
+		});
+	}
+
 	for (const FUnrealObjectRef& UnresolvedRef : UnresolvedRefs)
 	{
 		UE_LOG(LogSpatialReceiver, Log, TEXT("Added pending incoming property for object ref: %s, target object: %s"), *UnresolvedRef.ToString(), *ChannelObjectPair.Value->GetName());
-		IncomingRefsMap.FindOrAdd(UnresolvedRef).Add(ChannelObjectPair);
+		ObjectUnresolvedRefs->IncomingRefs.Add(UnresolvedRef);
+	}
+}
+
+void USpatialReceiver::RemoveUnresolvedRefs(const FChannelObjectPair& ChannelObjectPair)
+{
+	TMap<TWeakObjectPtr<UObject>, FUnresolvedObjectRefs>* ChannelUnresolvedRefs = UnresolvedRefsMap.Find(ChannelObjectPair.Key);
+	if (ChannelUnresolvedRefs == nullptr)
+	{
+		return;
+	}
+
+	if (FUnresolvedObjectRefs* ObjectUnresolvedRefs = ChannelUnresolvedRefs->Find(ChannelObjectPair.Value))
+	{
+		RemoveIncomingRefs(ChannelObjectPair, ObjectUnresolvedRefs->IncomingRefs);
+		ChannelUnresolvedRefs->Remove(ChannelObjectPair.Value);
 	}
 
-	if (ObjectReferencesMap.Num() == 0)
+	if (ChannelUnresolvedRefs->Num() == 0)
+	{
+		UnresolvedRefsMap.Remove(ChannelObjectPair.Key);
+	}
+}
+
+void USpatialReceiver::RemoveIncomingRefs(const FChannelObjectPair& ChannelObjectPair, const TSet<FUnrealObjectRef>& IncomingRefs)
+{
+	for (const FUnrealObjectRef& IncomingRef : IncomingRefs)
 	{
-		UnresolvedRefsMap.Remove(ChannelObjectPair);
+		if (TMap<FChannelObjectPair, TSet<int32>>* DependentObjects = IncomingRefsMap.Find(IncomingRef))
+		{
+			DependentObjects->Remove(ChannelObjectPair);
+			if (DependentObjects->Num() == 0)
+			{
+				IncomingRefsMap.Remove(IncomingRef);
+			}
+		}
 	}
 }
 
+void USpatialReceiver::CleanupUnresolvedRefs(USpatialActorChannel* Channel)
+{
+	TMap<TWeakObjectPtr<UObject>, FUnresolvedObjectRefs>* ChannelUnresolvedRefs = UnresolvedRefsMap.Find(Channel);
+	if (ChannelUnresolvedRefs == nullptr)
+	{
+		return;
+	}
+
+	for (const auto& ObjectUnresolvedRefs : *ChannelUnresolvedRefs)
+	{
+		RemoveIncomingRefs(FChannelObjectPair(Channel, ObjectUnresolvedRefs.Key), ObjectUnresolvedRefs.Value.IncomingRefs);
+	}
+
+	UnresolvedRefsMap.Remove(Channel);
+}
+
 void USpatialReceiver::QueueIncomingRPC(FPendingRPCParamsPtr Params)
 {
 	TWeakObjectPtr<UObject> TargetObjectWeakPtr = PackageMap->GetObjectFromUnrealObjectRef(Params->ObjectRef);
@@ -1750,40 +1977,86 @@ void USpatialReceiver::ResolvePendingOperations_Internal(UObject* Object, const
 
 	Sender->ResolveOutgoingOperations(Object, /* bIsHandover */ false);
 	Sender->ResolveOutgoingOperations(Object, /* bIsHandover */ true);
-	ResolveIncomingOperations(Object, ObjectRef);
-	// TODO: UNR-1650 We're trying to resolve all queues, which introduces more overhead.
-	ResolveIncomingRPCs();
+	ResolvedIncomingRefs.Add(ObjectRef);
+	IncomingRPCs.UnblockEntity(ObjectRef.Entity);
+
+	if (!bBatchingResolvedObjectRefs)
+	{
+		FlushResolvedObjectRefs();
+	}
 }
 
-void USpatialReceiver::ResolveIncomingOperations(UObject* Object, const FUnrealObjectRef& ObjectRef)
+void USpatialReceiver::BeginBatchingResolvedObjectRefs()
 {
-	// TODO: queue up resolved objects since they were resolved during process ops
-	// and then resolve all of them at the end of process ops - UNR:582
+	bBatchingResolvedObjectRefs = true;
+}
 
-	TSet<FChannelObjectPair>* TargetObjectSet = IncomingRefsMap.Find(ObjectRef);
-	if (!TargetObjectSet)
+void USpatialReceiver::FlushResolvedObjectRefs()
+{
+	// Objects resolved by RepNotifies or RPCs run while flushing are picked up by the next iteration.
+	bBatchingResolvedObjectRefs = true;
+
+	while (ResolvedIncomingRefs.Num() > 0)
 	{
-		return;
+		ResolveIncomingOperations();
+		// TODO: UNR-1650 We're trying to resolve all queues, which introduces more overhead.
+		ResolveIncomingRPCs();
 	}
 
-	UE_LOG(LogSpatialReceiver, Verbose, TEXT("Resolving incoming operations depending on object ref %s, resolved object: %s"), *ObjectRef.ToString(), *Object->GetName());
+	bBatchingResolvedObjectRefs = false;
+
+	SET_DWORD_STAT(STAT_SpatialUnresolvedIncomingObjectRefs, IncomingRefsMap.Num());
+}
+
+void USpatialReceiver::ResolveIncomingOperations()
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpatialReceiverResolveIncomingOperations);
+
+	// Gather the properties waiting on any of the resolved refs, so that each object is only resolved once.
+	TMap<FChannelObjectPair, TSet<int32>> DirtyObjects;
+	for (const FUnrealObjectRef& ObjectRef : ResolvedIncomingRefs)
+	{
+		TMap<FChannelObjectPair, TSet<int32>>* DependentObjects = IncomingRefsMap.Find(ObjectRef);
+		if (DependentObjects == nullptr)
+		{
+			continue;
+		}
+
+		UE_LOG(LogSpatialReceiver, Verbose, TEXT("Resolving incoming operations depending on object ref %s"), *ObjectRef.ToString());
 
-	for (FChannelObjectPair& ChannelObjectPair : *TargetObjectSet)
+		for (const auto& DependentObject : *DependentObjects)
+		{
+			DirtyObjects.FindOrAdd(DependentObject.Key).Append(DependentObject.Value);
+
+			if (FUnresolvedObjectRefs* ObjectUnresolvedRefs = FindUnresolvedRefs(DependentObject.Key))
+			{
+				ObjectUnresolvedRefs->IncomingRefs.Remove(ObjectRef);
+			}
+		}
+
+		IncomingRefsMap.Remove(ObjectRef);
+	}
+	ResolvedIncomingRefs.Empty();
+
+	for (const auto& DirtyObject : DirtyObjects)
 	{
-		FObjectReferencesMap* UnresolvedRefs = UnresolvedRefsMap.Find(ChannelObjectPair);
-		if (!UnresolvedRefs)
+		const FChannelObjectPair& ChannelObjectPair = DirtyObject.Key;
+
+		FUnresolvedObjectRefs* ObjectUnresolvedRefs = FindUnresolvedRefs(ChannelObjectPair);
+		if (ObjectUnresolvedRefs == nullptr)
 		{
 			continue;
 		}
 
 		if (!ChannelObjectPair.Key.IsValid() || !ChannelObjectPair.Value.IsValid())
 		{
-			UnresolvedRefsMap.Remove(ChannelObjectPair);
+			RemoveUnresolvedRefs(ChannelObjectPair);
 			continue;
 		}
 
 		USpatialActorChannel* DependentChannel = ChannelObjectPair.Key.Get();
 		UObject* ReplicatingObject = ChannelObjectPair.Value.Get();
+		FObjectReferencesMap& UnresolvedRefs = ObjectUnresolvedRefs->ObjectReferencesMap;
 
 		bool bStillHasUnresolved = false;
 		bool bSomeObjectsWereMapped = false;
@@ -1791,30 +2064,44 @@ void USpatialReceiver::ResolveIncomingOperations(UObject* Object, const FUnrealO
 
 		FRepLayout& RepLayout = DependentChannel->GetObjectRepLayout(ReplicatingObject);
 		FRepStateStaticBuffer& ShadowData = DependentChannel->GetObjectStaticBuffer(ReplicatingObject);
+		const int32 MaxAbsOffset = ReplicatingObject->GetClass()->GetPropertiesSize();
 
-		ResolveObjectReferences(RepLayout, ReplicatingObject, *UnresolvedRefs, ShadowData.GetData(), (uint8*)ReplicatingObject, ReplicatingObject->GetClass()->GetPropertiesSize(), RepNotifies, bSomeObjectsWereMapped, bStillHasUnresolved);
+		for (int32 AbsOffset : DirtyObject.Value)
+		{
+			// The property may since have been overwritten by an update that resolved all of its refs.
+			FObjectReferences* ObjectReferences = UnresolvedRefs.Find(AbsOffset);
+			if (ObjectReferences == nullptr)
+			{
+				continue;
+			}
+
+			if (ResolveObjectReferencesAtOffset(RepLayout, ReplicatingObject, AbsOffset, *ObjectReferences, ShadowData.GetData(), (uint8*)ReplicatingObject, MaxAbsOffset, RepNotifies, bSomeObjectsWereMapped, bStillHasUnresolved))
+			{
+				UnresolvedRefs.Remove(AbsOffset);
+			}
+		}
 
 		if (bSomeObjectsWereMapped)
 		{
-			DependentChannel->RemoveRepNotifiesWithUnresolvedObjs(RepNotifies, RepLayout, *UnresolvedRefs, ReplicatingObject);
+			DependentChannel->RemoveRepNotifiesWithUnresolvedObjs(RepNotifies, RepLayout, UnresolvedRefs, ReplicatingObject);
 
 			UE_LOG(LogSpatialReceiver, Verbose, TEXT("Resolved for target object %s"), *ReplicatingObject->GetName());
 			DependentChannel->PostReceiveSpatialUpdate(ReplicatingObject, RepNotifies);
 		}
 
-		if (!bStillHasUnresolved)
+		// Looked up again as the RepNotifies can clean up the channel.
+		ObjectUnresolvedRefs = FindUnresolvedRefs(ChannelObjectPair);
+		if (ObjectUnresolvedRefs != nullptr && ObjectUnresolvedRefs->ObjectReferencesMap.Num() == 0)
 		{
-			UnresolvedRefsMap.Remove(ChannelObjectPair);
+			RemoveUnresolvedRefs(ChannelObjectPair);
 		}
 	}
-
-	IncomingRefsMap.Remove(ObjectRef);
 }
 
 void USpatialReceiver::ResolveIncomingRPCs()
 {
 	FProcessRPCDelegate Delegate;
-	Delegate.BindUObject(this, &USpatialReceiver::ApplyRPC);
+	Delegate.BindUObject(this, &USpatialReceiver::ApplyQueuedRPC);
 	IncomingRPCs.ProcessRPCs(Delegate);
 }
 
@@ -1822,145 +2109,145 @@ void USpatialReceiver::ResolveObjectReferences(FRepLayout& RepLayout, UObject* R
 {
 	for (auto It = ObjectReferencesMap.CreateIterator(); It; ++It)
 	{
-		int32 AbsOffset = It.Key();
-
-		if (AbsOffset >= MaxAbsOffset)
+		if (ResolveObjectReferencesAtOffset(RepLayout, ReplicatedObject, It.Key(), It.Value(), StoredData, Data, MaxAbsOffset, RepNotifies, bOutSomeObjectsWereMapped, bOutStillHasUnresolved))
 		{
-			UE_LOG(LogSpatialReceiver, Log, TEXT("ResolveObjectReferences: Removed unresolved reference: AbsOffset >= MaxAbsOffset: %d"), AbsOffset);
 			It.RemoveCurrent();
-			continue;
 		}
+	}
+}
 
-		FObjectReferences& ObjectReferences = It.Value();
+bool USpatialReceiver::ResolveObjectReferencesAtOffset(FRepLayout& RepLayout, UObject* ReplicatedObject, int32 AbsOffset, FObjectReferences& ObjectReferences, uint8* RESTRICT StoredData, uint8* RESTRICT Data, int32 MaxAbsOffset, TArray<UProperty*>& RepNotifies, bool& bOutSomeObjectsWereMapped, bool& bOutStillHasUnresolved)
+{
+	if (AbsOffset >= MaxAbsOffset)
+	{
+		UE_LOG(LogSpatialReceiver, Log, TEXT("ResolveObjectReferences: Removed unresolved reference: AbsOffset >= MaxAbsOffset: %d"), AbsOffset);
+		return true;
+	}
 
-		UProperty* Property = ObjectReferences.Property;
+	UProperty* Property = ObjectReferences.Property;
 
-		// ParentIndex is -1 for handover properties
-		bool bIsHandover = ObjectReferences.ParentIndex == -1;
-		FRepParentCmd* Parent = ObjectReferences.ParentIndex >= 0 ? &RepLayout.Parents[ObjectReferences.ParentIndex] : nullptr;
+	// ParentIndex is -1 for handover properties
+	bool bIsHandover = ObjectReferences.ParentIndex == -1;
+	FRepParentCmd* Parent = ObjectReferences.ParentIndex >= 0 ? &RepLayout.Parents[ObjectReferences.ParentIndex] : nullptr;
 
 #if ENGINE_MINOR_VERSION <= 20
-		int32 StoredDataOffset = AbsOffset;
+	int32 StoredDataOffset = AbsOffset;
 #else
-		int32 StoredDataOffset = ObjectReferences.ShadowOffset;
+	int32 StoredDataOffset = ObjectReferences.ShadowOffset;
 #endif
 
-		if (ObjectReferences.Array)
-		{
-			check(Property->IsA<UArrayProperty>());
+	if (ObjectReferences.Array)
+	{
+		check(Property->IsA<UArrayProperty>());
 
-			if (!bIsHandover)
-			{
-				Property->CopySingleValue(StoredData + StoredDataOffset, Data + AbsOffset);
-			}
+		if (!bIsHandover)
+		{
+			Property->CopySingleValue(StoredData + StoredDataOffset, Data + AbsOffset);
+		}
 
-			FScriptArray* StoredArray = bIsHandover ? nullptr : (FScriptArray*)(StoredData + StoredDataOffset);
-			FScriptArray* Array = (FScriptArray*)(Data + AbsOffset);
+		FScriptArray* StoredArray = bIsHandover ? nullptr : (FScriptArray*)(StoredData + StoredDataOffset);
+		FScriptArray* Array = (FScriptArray*)(Data + AbsOffset);
 
-			int32 NewMaxOffset = Array->Num() * Property->ElementSize;
+		int32 NewMaxOffset = Array->Num() * Property->ElementSize;
 
-			bool bArrayHasUnresolved = false;
-			ResolveObjectReferences(RepLayout, ReplicatedObject, *ObjectReferences.Array, bIsHandover ? nullptr : (uint8*)StoredArray->GetData(), (uint8*)Array->GetData(), NewMaxOffset, RepNotifies, bOutSomeObjectsWereMapped, bArrayHasUnresolved);
-			if (!bArrayHasUnresolved)
-			{
-				It.RemoveCurrent();
-			}
-			else
-			{
-				bOutStillHasUnresolved = true;
-			}
-			continue;
+		bool bArrayHasUnresolved = false;
+		ResolveObjectReferences(RepLayout, ReplicatedObject, *ObjectReferences.Array, bIsHandover ? nullptr : (uint8*)StoredArray->GetData(), (uint8*)Array->GetData(), NewMaxOffset, RepNotifies, bOutSomeObjectsWereMapped, bArrayHasUnresolved);
+		if (bArrayHasUnresolved)
+		{
+			bOutStillHasUnresolved = true;
+			return false;
 		}
 
-		bool bResolvedSomeRefs = false;
-		UObject* SinglePropObject = nullptr;
+		return true;
+	}
 
-		for (auto UnresolvedIt = ObjectReferences.UnresolvedRefs.CreateIterator(); UnresolvedIt; ++UnresolvedIt)
-		{
-			FUnrealObjectRef& ObjectRef = *UnresolvedIt;
+	bool bResolvedSomeRefs = false;
+	UObject* SinglePropObject = nullptr;
 
-			FNetworkGUID NetGUID = PackageMap->GetNetGUIDFromUnrealObjectRef(ObjectRef);
-			if (NetGUID.IsValid())
-			{
-				UObject* Object = PackageMap->GetObjectFromNetGUID(NetGUID, true);
-				check(Object);
+	for (auto UnresolvedIt = ObjectReferences.UnresolvedRefs.CreateIterator(); UnresolvedIt; ++UnresolvedIt)
+	{
+		FUnrealObjectRef& ObjectRef = *UnresolvedIt;
 
-				UE_LOG(LogSpatialReceiver, Verbose, TEXT("ResolveObjectReferences: Resolved object ref: Offset: %d, Object ref: %s, PropName: %s, ObjName: %s"), AbsOffset, *ObjectRef.ToString(), *Property->GetNameCPP(), *Object->GetName());
+		FNetworkGUID NetGUID = PackageMap->GetNetGUIDFromUnrealObjectRef(ObjectRef);
+		if (NetGUID.IsValid())
+		{
+			UObject* Object = PackageMap->GetObjectFromNetGUID(NetGUID, true);
+			check(Object);
 
-				UnresolvedIt.RemoveCurrent();
-				bResolvedSomeRefs = true;
+			UE_LOG(LogSpatialReceiver, Verbose, TEXT("ResolveObjectReferences: Resolved object ref: Offset: %d, Object ref: %s, PropName: %s, ObjName: %s"), AbsOffset, *ObjectRef.ToString(), *Property->GetNameCPP(), *Object->GetName());
 
-				if (ObjectReferences.bSingleProp)
-				{
-					SinglePropObject = Object;
-				}
-			}
-		}
+			UnresolvedIt.RemoveCurrent();
+			bResolvedSomeRefs = true;
 
-		if (bResolvedSomeRefs)
-		{
-			if (!bOutSomeObjectsWereMapped)
+			if (ObjectReferences.bSingleProp)
 			{
-				ReplicatedObject->PreNetReceive();
-				bOutSomeObjectsWereMapped = true;
+				SinglePropObject = Object;
 			}
+		}
+	}
 
-			if (Parent && Parent->Property->HasAnyPropertyFlags(CPF_RepNotify))
-			{
-				Property->CopySingleValue(StoredData + StoredDataOffset, Data + AbsOffset);
-			}
+	if (bResolvedSomeRefs)
+	{
+		if (!bOutSomeObjectsWereMapped)
+		{
+			ReplicatedObject->PreNetReceive();
+			bOutSomeObjectsWereMapped = true;
+		}
 
-			if (ObjectReferences.bSingleProp)
-			{
-				UObjectPropertyBase* ObjectProperty = Cast<UObjectPropertyBase>(Property);
-				check(ObjectProperty);
+		if (Parent && Parent->Property->HasAnyPropertyFlags(CPF_RepNotify))
+		{
+			Property->CopySingleValue(StoredData + StoredDataOffset, Data + AbsOffset);
+		}
 
-				ObjectProperty->SetObjectPropertyValue(Data + AbsOffset, SinglePropObject);
-			}
-			else if (ObjectReferences.bFastArrayProp)
-			{
-				TSet<FUnrealObjectRef> NewUnresolvedRefs;
-				FSpatialNetBitReader ValueDataReader(PackageMap, ObjectReferences.Buffer.GetData(), ObjectReferences.NumBufferBits, NewUnresolvedRefs);
+		if (ObjectReferences.bSingleProp)
+		{
+			UObjectPropertyBase* ObjectProperty = Cast<UObjectPropertyBase>(Property);
+			check(ObjectProperty);
 
-				check(Property->IsA<UArrayProperty>());
-				UScriptStruct* NetDeltaStruct = GetFastArraySerializerProperty(Cast<UArrayProperty>(Property));
+			ObjectProperty->SetObjectPropertyValue(Data + AbsOffset, SinglePropObject);
+		}
+		else if (ObjectReferences.bFastArrayProp)
+		{
+			TSet<FUnrealObjectRef> NewUnresolvedRefs;
+			FSpatialNetBitReader ValueDataReader(PackageMap, ObjectReferences.Buffer.GetData(), ObjectReferences.NumBufferBits, NewUnresolvedRefs);
 
-				FSpatialNetDeltaSerializeInfo::DeltaSerializeRead(NetDriver, ValueDataReader, ReplicatedObject, Parent->ArrayIndex, Parent->Property, NetDeltaStruct);
+			check(Property->IsA<UArrayProperty>());
+			UScriptStruct* NetDeltaStruct = GetFastArraySerializerProperty(Cast<UArrayProperty>(Property));
 
-				if (NewUnresolvedRefs.Num() > 0)
-				{
-					bOutStillHasUnresolved = true;
-				}
-			}
-			else
-			{
-				TSet<FUnrealObjectRef> NewUnresolvedRefs;
-				FSpatialNetBitReader BitReader(PackageMap, ObjectReferences.Buffer.GetData(), ObjectReferences.NumBufferBits, NewUnresolvedRefs);
-				check(Property->IsA<UStructProperty>());
-				ReadStructProperty(BitReader, Cast<UStructProperty>(Property), NetDriver, Data + AbsOffset, bOutStillHasUnresolved);
-			}
+			FSpatialNetDeltaSerializeInfo::DeltaSerializeRead(NetDriver, ValueDataReader, ReplicatedObject, Parent->ArrayIndex, Parent->Property, NetDeltaStruct);
 
-			if (Parent && Parent->Property->HasAnyPropertyFlags(CPF_RepNotify))
+			if (NewUnresolvedRefs.Num() > 0)
 			{
-				if (Parent->RepNotifyCondition == REPNOTIFY_Always || !Property->Identical(StoredData + StoredDataOffset, Data + AbsOffset))
-				{
-					RepNotifies.AddUnique(Parent->Property);
-				}
+				bOutStillHasUnresolved = true;
 			}
 		}
-
-		if (ObjectReferences.UnresolvedRefs.Num() > 0)
+		else
 		{
-			bOutStillHasUnresolved = true;
+			TSet<FUnrealObjectRef> NewUnresolvedRefs;
+			FSpatialNetBitReader BitReader(PackageMap, ObjectReferences.Buffer.GetData(), ObjectReferences.NumBufferBits, NewUnresolvedRefs);
+			check(Property->IsA<UStructProperty>());
+			ReadStructProperty(BitReader, Cast<UStructProperty>(Property), NetDriver, Data + AbsOffset, bOutStillHasUnresolved);
 		}
-		else
+
+		if (Parent && Parent->Property->HasAnyPropertyFlags(CPF_RepNotify))
 		{
-			It.RemoveCurrent();
+			if (Parent->RepNotifyCondition == REPNOTIFY_Always || !Property->Identical(StoredData + StoredDataOffset, Data + AbsOffset))
+			{
+				RepNotifies.AddUnique(Parent->Property);
+			}
 		}
 	}
+
+	if (ObjectReferences.UnresolvedRefs.Num() > 0)
+	{
+		bOutStillHasUnresolved = true;
+		return false;
+	}
+
+	return true;
 }
 
-void USpatialReceiver::OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp& Op)
+void USpatialReceiver::OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp& Op, FDecodedComponentUpdate* DecodedUpdate)
 {
 	if (!NetDriver->IsServer())
 	{
@@ -1985,8 +2272,23 @@ void USpatialReceiver::OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp
 
 	USpatialNetConnection* NetConnection = ConnectionPtr->Get();
 
-	Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(Op.update.schema_type);
-	uint32 EventCount = Schema_GetObjectCount(EventsObject, SpatialConstants::HEARTBEAT_EVENT_ID);
+	uint32 EventCount = 0;
+	bool bClientHasQuit = false;
+	if (DecodedUpdate != nullptr)
+	{
+		EventCount = DecodedUpdate->HeartbeatEventCount;
+		bClientHasQuit = DecodedUpdate->bClientHasQuit;
+	}
+	else
+	{
+		Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(Op.update.schema_type);
+		EventCount = Schema_GetObjectCount(EventsObject, SpatialConstants::HEARTBEAT_EVENT_ID);
+
+		Schema_Object* FieldsObject = Schema_GetComponentUpdateFields(Op.update.schema_type);
+		bClientHasQuit = Schema_GetBoolCount(FieldsObject, SpatialConstants::HEARTBEAT_CLIENT_HAS_QUIT_ID) > 0 &&
+			GetBoolFromSchema(FieldsObject, SpatialConstants::HEARTBEAT_CLIENT_HAS_QUIT_ID);
+	}
+
 	if (EventCount > 0)
 	{
 		if (EventCount > 1)
@@ -1997,12 +2299,28 @@ void USpatialReceiver::OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp
 		NetConnection->OnHeartbeat();
 	}
 
-	Schema_Object* FieldsObject = Schema_GetComponentUpdateFields(Op.update.schema_type);
-	if (Schema_GetBoolCount(FieldsObject, SpatialConstants::HEARTBEAT_CLIENT_HAS_QUIT_ID) > 0 &&
-		GetBoolFromSchema(FieldsObject, SpatialConstants::HEARTBEAT_CLIENT_HAS_QUIT_ID))
+	if (bClientHasQuit)
 	{
 		// Client has disconnected, let's clean up their connection.
 		NetConnection->CleanUp();
 		AuthorityPlayerControllerConnectionMap.Remove(Op.entity_id);
 	}
 } 
+
+void USpatialReceiver::ApplyPositionStream(Schema_Object* ComponentObject)
+{
+	// Streamed positions only update the view of Position, which the authoritative worker keeps sending at a lower rate.
+	FPositionStream::Read(ComponentObject, [this](Worker_EntityId EntityId, const FVector& Location)
+	{
+		if (StaticComponentView->HasAuthority(EntityId, SpatialConstants::POSITION_COMPONENT_ID))
+		{
+			return;
+		}
+
+		if (Position* EntityPosition = StaticComponentView->GetComponentData<Position>(EntityId))
+		{
+			EntityPosition->Coords = Coordinates::FromFVector(Location);
+			INC_DWORD_STAT(STAT_SpatialStreamedPositionsReceived);
+		}
+	});
+}
@@ -4,8 +4,10 @@
 
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/PlayerState.h"
+#include "GameFramework/WorldSettings.h"
 
 #include "Engine/Engine.h"
+#include "Hash/CityHash.h"
 #include "EngineClasses/SpatialActorChannel.h"
 #include "EngineClasses/SpatialNetConnection.h"
 #include "EngineClasses/SpatialNetDriver.h"
@@ -36,6 +38,11 @@ DEFINE_LOG_CATEGORY(LogSpatialSender);
 using namespace SpatialGDK;
 
 DECLARE_CYCLE_STAT(TEXT("SendComponentUpdates"), STAT_SpatialSenderSendComponentUpdates, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("FlushComponentUpdates"), STAT_SpatialSenderFlushComponentUpdates, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("FlushCreateEntityRequests"), STAT_SpatialSenderFlushCreateEntityRequests, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("FlushPositionStream"), STAT_SpatialSenderFlushPositionStream, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Streamed Positions Sent"), STAT_SpatialStreamedPositionsSent, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Position Stream Bytes Sent"), STAT_SpatialPositionStreamBytesSent, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("ResetOutgoingUpdate"), STAT_SpatialSenderResetOutgoingUpdate, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("QueueOutgoingUpdate"), STAT_SpatialSenderQueueOutgoingUpdate, STATGROUP_SpatialNet);
 
@@ -50,14 +57,6 @@ FReliableRPCForRetry::FReliableRPCForRetry(UObject* InTargetObject, UFunction* I
 {
 }
 
-FPendingRPC::FPendingRPC(FPendingRPC&& Other)
-	: Offset(Other.Offset)
-	, Index(Other.Index)
-	, Data(MoveTemp(Other.Data))
-	, Entity(Other.Entity)
-{
-}
-
 void USpatialSender::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimerManager)
 {
 	NetDriver = InNetDriver;
@@ -68,9 +67,17 @@ void USpatialSender::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimer
 	ClassInfoManager = InNetDriver->ClassInfoManager;
 	ActorGroupManager = InNetDriver->ActorGroupManager;
 	TimerManager = InTimerManager;
+
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	OutgoingRPCs.SetQueueLimits(SCHEMA_ClientUnreliableRPC, SpatialGDKSettings->QueuedUnreliableRPCTimeToLive, SpatialGDKSettings->MaxQueuedUnreliableRPCsPerEntity);
+	OutgoingRPCs.SetQueueLimits(SCHEMA_ServerUnreliableRPC, SpatialGDKSettings->QueuedUnreliableRPCTimeToLive, SpatialGDKSettings->MaxQueuedUnreliableRPCsPerEntity);
+	EntityCreationScheduler.SetBudget(SpatialGDKSettings->EntityCreationRequestsPerSecond, SpatialGDKSettings->EntityCreationBytesPerSecond);
+	PositionStream.SetCellSize(SpatialGDKSettings->PositionStreamCellSize);
+	bCoalesceComponentUpdates = SpatialGDKSettings->bCoalesceComponentUpdates;
+	UpdateCoalescer.Init(Connection);
 }
 
-Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
+TArray<Worker_ComponentData> USpatialSender::CreateEntityComponents(USpatialActorChannel* Channel)
 {
 	AActor* Actor = Channel->Actor;
 	UClass* Class = Actor->GetClass();
@@ -255,7 +262,9 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
 	}
 
 	InterestFactory InterestDataFactory(Actor, Info, NetDriver);
-	ComponentDatas.Add(InterestDataFactory.CreateInterestData());
+	Worker_ComponentData InterestData = InterestDataFactory.CreateInterestData();
+	HasInterestChanged(Channel->GetEntityId(), Schema_GetComponentDataFields(InterestData.schema_type));
+	ComponentDatas.Add(InterestData);
 
 	ComponentDatas.Add(ClientRPCEndpoint().CreateRPCEndpointData());
 	ComponentDatas.Add(ServerRPCEndpoint().CreateRPCEndpointData());
@@ -365,6 +374,11 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
 
 	ComponentDatas.Add(EntityAcl(ReadAcl, ComponentWriteAcl).CreateEntityAclData());
 
+	return ComponentDatas;
+}
+
+Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel, TArray<Worker_ComponentData>&& ComponentDatas)
+{
 	Worker_EntityId EntityId = Channel->GetEntityId();
 	Worker_RequestId CreateEntityRequestId = Connection->SendCreateEntityRequest(MoveTemp(ComponentDatas), &EntityId);
 	PendingActorRequests.Add(CreateEntityRequestId, Channel);
@@ -372,6 +386,33 @@ Worker_RequestId USpatialSender::CreateEntity(USpatialActorChannel* Channel)
 	return CreateEntityRequestId;
 }
 
+EEntityCreationPriority USpatialSender::GetEntityCreationPriority(const AActor* Actor) const
+{
+	if (Actor->GetNetConnection() != nullptr)
+	{
+		return EEntityCreationPriority::PlayerOwned;
+	}
+
+	if (Actor->bAlwaysRelevant)
+	{
+		return EEntityCreationPriority::RelevantToViewer;
+	}
+
+	// Viewers are only gathered while actors are being replicated, so requests retried from elsewhere fall through to Other.
+	if (const AWorldSettings* WorldSettings = NetDriver->World->GetWorldSettings())
+	{
+		for (const FNetViewer& Viewer : WorldSettings->ReplicationViewers)
+		{
+			if (Actor->IsNetRelevantFor(Viewer.InViewer, Viewer.ViewTarget, Viewer.ViewLocation))
+			{
+				return EEntityCreationPriority::RelevantToViewer;
+			}
+		}
+	}
+
+	return EEntityCreationPriority::Other;
+}
+
 Worker_ComponentData USpatialSender::CreateLevelComponentData(AActor* Actor)
 {
 	UWorld* ActorWorld = Actor->GetTypedOuter<UWorld>();
@@ -413,6 +454,9 @@ void USpatialSender::SendAddComponent(USpatialActorChannel* Channel, UObject* Su
 		QueueOutgoingUpdate(Channel, Subobject, HandleUnresolvedObjectsPair.Key, HandleUnresolvedObjectsPair.Value, /* bIsHandover */ true);
 	}
 
+	// Updates queued earlier may be needed to resolve references in the new component.
+	UpdateCoalescer.FlushUpdatesForEntity(Channel->GetEntityId());
+
 	for (Worker_ComponentData& ComponentData : SubobjectDatas)
 	{
 		Connection->SendAddComponent(Channel->GetEntityId(), &ComponentData);
@@ -460,6 +504,7 @@ void USpatialSender::SendRemoveComponent(Worker_EntityId EntityId, const FClassI
 	{
 		if (SubobjectComponentId != SpatialConstants::INVALID_COMPONENT_ID)
 		{
+			UpdateCoalescer.DiscardUpdatesForComponent(EntityId, SubobjectComponentId);
 			NetDriver->Connection->SendRemoveComponent(EntityId, SubobjectComponentId);
 		}
 	}
@@ -470,6 +515,7 @@ void USpatialSender::SendRemoveComponent(Worker_EntityId EntityId, const FClassI
 // Creates an entity authoritative on this server worker, ensuring it will be able to receive updates for the GSM.
 void USpatialSender::CreateServerWorkerEntity(int AttemptCounter)
 {
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
 	const WorkerRequirementSet WorkerIdPermission{ { FString::Format(TEXT("workerId:{0}"), { Connection->GetWorkerId() }) } };
 
 	WriteAclMap ComponentWriteAcl;
@@ -478,10 +524,31 @@ void USpatialSender::CreateServerWorkerEntity(int AttemptCounter)
 	ComponentWriteAcl.Add(SpatialConstants::ENTITY_ACL_COMPONENT_ID, WorkerIdPermission);
 	ComponentWriteAcl.Add(SpatialConstants::INTEREST_COMPONENT_ID, WorkerIdPermission);
 
+	WorkerRequirementSet ReadAcl = WorkerIdPermission;
+
 	QueryConstraint Constraint;
 	// Ensure server worker receives the GSM entity
 	Constraint.EntityIdConstraint = SpatialConstants::INITIAL_GLOBAL_STATE_MANAGER_ENTITY_ID;
 
+	if (SpatialGDKSettings->bUsePositionStream)
+	{
+		ComponentWriteAcl.Add(SpatialConstants::POSITION_STREAM_COMPONENT_ID, WorkerIdPermission);
+
+		// Every server worker reads the position streams of the others, so they are interested in each other's worker entity.
+		for (const FName& WorkerType : SpatialGDKSettings->ServerWorkerTypes)
+		{
+			ReadAcl.Add({ WorkerType.ToString() });
+		}
+
+		QueryConstraint PositionStreamConstraint;
+		PositionStreamConstraint.ComponentConstraint = SpatialConstants::POSITION_STREAM_COMPONENT_ID;
+
+		QueryConstraint GSMConstraint = Constraint;
+		Constraint = QueryConstraint();
+		Constraint.OrConstraint.Add(GSMConstraint);
+		Constraint.OrConstraint.Add(PositionStreamConstraint);
+	}
+
 	Query Query;
 	Query.Constraint = Constraint;
 	Query.FullSnapshotResult = true;
@@ -495,8 +562,12 @@ void USpatialSender::CreateServerWorkerEntity(int AttemptCounter)
 	TArray<Worker_ComponentData> Components;
 	Components.Add(Position().CreatePositionData());
 	Components.Add(Metadata(FString::Format(TEXT("WorkerEntity:{0}"), { Connection->GetWorkerId() })).CreateMetadataData());
-	Components.Add(EntityAcl(WorkerIdPermission, ComponentWriteAcl).CreateEntityAclData());
+	Components.Add(EntityAcl(ReadAcl, ComponentWriteAcl).CreateEntityAclData());
 	Components.Add(Interest.CreateInterestData());
+	if (SpatialGDKSettings->bUsePositionStream)
+	{
+		Components.Add(FPositionStream::CreateEmptyData(SpatialGDKSettings->PositionStreamCellSize));
+	}
 
 	Worker_RequestId RequestId = Connection->SendCreateEntityRequest(MoveTemp(Components), nullptr);
 
@@ -585,6 +656,15 @@ void USpatialSender::SendComponentUpdates(UObject* Object, const FClassInfo& Inf
 		}
 	}
 
+	if (GetDefault<USpatialGDKSettings>()->ReplicationBytesPerTick > 0)
+	{
+		for (const Worker_ComponentUpdate& Update : ComponentUpdates)
+		{
+			ComponentUpdateBytes += Schema_GetWriteBufferLength(Schema_GetComponentUpdateFields(Update.schema_type));
+			ComponentUpdateBytes += Schema_GetWriteBufferLength(Schema_GetComponentUpdateEvents(Update.schema_type));
+		}
+	}
+
 	for (Worker_ComponentUpdate& Update : ComponentUpdates)
 	{
 		if (!NetDriver->StaticComponentView->HasAuthority(EntityId, Update.component_id))
@@ -599,7 +679,7 @@ void USpatialSender::SendComponentUpdates(UObject* Object, const FClassInfo& Inf
 			continue;
 		}
 
-		Connection->SendComponentUpdate(EntityId, &Update);
+		SendOrCoalesceComponentUpdate(EntityId, Update);
 	}
 }
 
@@ -610,7 +690,7 @@ void USpatialSender::ProcessUpdatesQueuedUntilAuthority(Worker_EntityId EntityId
 	{
 		for (Worker_ComponentUpdate& Update : *UpdatesQueuedUntilAuthority)
 		{
-			Connection->SendComponentUpdate(EntityId, &Update);
+			SendOrCoalesceComponentUpdate(EntityId, Update);
 		}
 		UpdatesQueuedUntilAuthorityMap.Remove(EntityId);
 	}
@@ -618,39 +698,52 @@ void USpatialSender::ProcessUpdatesQueuedUntilAuthority(Worker_EntityId EntityId
 
 void USpatialSender::FlushPackedRPCs()
 {
-	if (RPCsToPack.Num() == 0)
+	if (PackedRPCUpdates.Num() == 0)
 	{
 		return;
 	}
 
 	// TODO: This could be further optimized for the case when there's only 1 RPC to be sent during this frame
 	// by sending it directly to the corresponding entity, without including the EntityId in the payload - UNR-1563.
-	for (const auto& It : RPCsToPack)
+	for (auto& It : PackedRPCUpdates)
 	{
-		Worker_EntityId PlayerControllerEntityId = It.Key;
-		const TArray<FPendingRPC>& PendingRPCArray = It.Value;
+		SendOrCoalesceComponentUpdate(It.Key, It.Value);
+	}
 
-		Worker_ComponentUpdate ComponentUpdate = {};
+	PackedRPCUpdates.Empty();
+}
+
+void USpatialSender::SendOrCoalesceComponentUpdate(Worker_EntityId EntityId, Worker_ComponentUpdate& Update)
+{
+	if (bCoalesceComponentUpdates)
+	{
+		UpdateCoalescer.QueueUpdate(EntityId, Update);
+	}
+	else
+	{
+		Connection->SendComponentUpdate(EntityId, &Update);
+	}
+}
+
+void USpatialSender::FlushComponentUpdates()
+{
+	if (!bCoalesceComponentUpdates)
+	{
+		return;
+	}
 
-		Worker_ComponentId ComponentId = NetDriver->IsServer() ? SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID : SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID;
-		ComponentUpdate.component_id = ComponentId;
-		ComponentUpdate.schema_type = Schema_CreateComponentUpdate(ComponentId);
-		Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(ComponentUpdate.schema_type);
+	SCOPE_CYCLE_COUNTER(STAT_SpatialSenderFlushComponentUpdates);
 
-		for (const FPendingRPC& RPC : PendingRPCArray)
-		{
-			Schema_Object* EventData = Schema_AddObject(EventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_PACKED_EVENT_ID);
+	UpdateCoalescer.Flush();
 
-			Schema_AddUint32(EventData, SpatialConstants::UNREAL_RPC_PAYLOAD_OFFSET_ID, RPC.Offset);
-			Schema_AddUint32(EventData, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_INDEX_ID, RPC.Index);
-			SpatialGDK::AddBytesToSchema(EventData, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_PAYLOAD_ID, RPC.Data.GetData(), RPC.Data.Num());
-			Schema_AddEntityId(EventData, SpatialConstants::UNREAL_PACKED_RPC_PAYLOAD_ENTITY_ID, RPC.Entity);
-		}
+	uint32 QueuedCount = 0;
+	uint32 SentCount = 0;
+	UpdateCoalescer.ConsumeCounts(QueuedCount, SentCount);
 
-		Connection->SendComponentUpdate(PlayerControllerEntityId, &ComponentUpdate);
+	if (QueuedCount > 0)
+	{
+		NetDriver->SpatialMetrics->TrackCoalescedComponentUpdates(QueuedCount, SentCount);
 	}
-
-	RPCsToPack.Empty();
 }
 
 void FillComponentInterests(const FClassInfo& Info, bool bNetOwned, TArray<Worker_InterestOverride>& ComponentInterest)
@@ -711,7 +804,7 @@ RPCPayload USpatialSender::CreateRPCPayloadFromParams(UObject* TargetObject, UFu
 		UE_LOG(LogSpatialSender, Warning, TEXT("Some RPC parameters for %s were not resolved."), *Function->GetName());
 	}
 
-	return RPCPayload(TargetObjectRef.Offset, RPCInfo.Index, TArray<uint8>(PayloadWriter.GetData(), PayloadWriter.GetNumBytes()));
+	return RPCPayload(TargetObjectRef.Offset, RPCInfo.Index, MoveTemp(PayloadWriter));
 }
 
 void USpatialSender::SendComponentInterestForActor(USpatialActorChannel* Channel, Worker_EntityId EntityId, bool bNetOwned)
@@ -740,8 +833,59 @@ void USpatialSender::SendPositionUpdate(Worker_EntityId EntityId, const FVector&
 	}
 #endif
 
+	// The worker entity is created asynchronously, so positions are sent as Position updates until it exists.
+	if (GetDefault<USpatialGDKSettings>()->bUsePositionStream && NetDriver->WorkerEntityId != SpatialConstants::INVALID_ENTITY_ID)
+	{
+		PositionStream.Add(EntityId, Location);
+		PendingPositionUpdates.Add(EntityId, Location);
+		return;
+	}
+
 	Worker_ComponentUpdate Update = Position::CreatePositionUpdate(Coordinates::FromFVector(Location));
-	Connection->SendComponentUpdate(EntityId, &Update);
+	SendOrCoalesceComponentUpdate(EntityId, Update);
+}
+
+void USpatialSender::FlushPositionStream()
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpatialSenderFlushPositionStream);
+
+	if (!PositionStream.IsEmpty() && StaticComponentView->HasAuthority(NetDriver->WorkerEntityId, SpatialConstants::POSITION_STREAM_COMPONENT_ID))
+	{
+		INC_DWORD_STAT_BY(STAT_SpatialStreamedPositionsSent, PositionStream.Num());
+
+		Worker_ComponentUpdate Update = PositionStream.CreateUpdate();
+		INC_DWORD_STAT_BY(STAT_SpatialPositionStreamBytesSent, Schema_GetWriteBufferLength(Schema_GetComponentUpdateFields(Update.schema_type)));
+		SendOrCoalesceComponentUpdate(NetDriver->WorkerEntityId, Update);
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (PendingPositionUpdates.Num() == 0 || Now - TimeWhenPositionsLastSent < 1.0 / GetDefault<USpatialGDKSettings>()->PositionStreamPositionUpdateFrequency)
+	{
+		return;
+	}
+	TimeWhenPositionsLastSent = Now;
+
+	for (const TPair<Worker_EntityId_Key, FVector>& PendingPosition : PendingPositionUpdates)
+	{
+		// Authority may have been lost, or the entity deleted, since the position was streamed.
+		if (StaticComponentView->HasAuthority(PendingPosition.Key, SpatialConstants::POSITION_COMPONENT_ID))
+		{
+			Worker_ComponentUpdate Update = Position::CreatePositionUpdate(Coordinates::FromFVector(PendingPosition.Value));
+			SendOrCoalesceComponentUpdate(PendingPosition.Key, Update);
+		}
+	}
+	PendingPositionUpdates.Reset();
+}
+
+EProcessRPCResult USpatialSender::SendQueuedRPC(const FPendingRPCParams& Params)
+{
+	if (!PackageMap->GetObjectFromUnrealObjectRef(Params.ObjectRef).IsValid())
+	{
+		// Target object was destroyed before the RPC could be resent
+		return EProcessRPCResult::Drop;
+	}
+
+	return SendRPC(Params) ? EProcessRPCResult::Processed : EProcessRPCResult::Retry;
 }
 
 bool USpatialSender::SendRPC(const FPendingRPCParams& Params)
@@ -807,6 +951,9 @@ bool USpatialSender::SendRPC(const FPendingRPCParams& Params)
 		}
 
 		check(EntityId != SpatialConstants::INVALID_ENTITY_ID);
+
+		// Commands are sent straight away, so send the property updates the RPC may depend on first.
+		UpdateCoalescer.FlushUpdatesForEntity(EntityId);
 		Worker_RequestId RequestId = Connection->SendCommandRequest(EntityId, &CommandRequest, SpatialConstants::UNREAL_RPC_ENDPOINT_COMMAND_ID);
 
 #if !UE_BUILD_SHIPPING
@@ -910,7 +1057,7 @@ bool USpatialSender::SendRPC(const FPendingRPCParams& Params)
 				return false;
 			}
 
-			Connection->SendComponentUpdate(EntityId, &ComponentUpdate);
+			SendOrCoalesceComponentUpdate(EntityId, ComponentUpdate);
 #if !UE_BUILD_SHIPPING
 			NetDriver->SpatialMetrics->TrackSentRPC(Function, RPCInfo.Type, Params.Payload.PayloadData.Num());
 #endif // !UE_BUILD_SHIPPING
@@ -956,6 +1103,7 @@ void USpatialSender::RetryReliableRPC(TSharedRef<FReliableRPCForRetry> RetryRPC)
 	}
 
 	Worker_CommandRequest CommandRequest = CreateRetryRPCCommandRequest(*RetryRPC, TargetObjectRef.Offset);
+	UpdateCoalescer.FlushUpdatesForEntity(TargetObjectRef.Entity);
 	Worker_RequestId RequestId = Connection->SendCommandRequest(TargetObjectRef.Entity, &CommandRequest, SpatialConstants::UNREAL_RPC_ENDPOINT_COMMAND_ID);
 
 	// The number of attempts is used to determine the delay in case the command times out and we need to resend it.
@@ -985,14 +1133,48 @@ void USpatialSender::ProcessPositionUpdates()
 
 void USpatialSender::SendCreateEntityRequest(USpatialActorChannel* Channel)
 {
+	// The components are built straight away, so the entity is created with the state the actor had when it was replicated.
+	TArray<Worker_ComponentData> ComponentDatas = CreateEntityComponents(Channel);
+
+	if (EntityCreationScheduler.IsLimited())
+	{
+		UE_LOG(LogSpatialSender, Log, TEXT("Queueing create entity request for %s with EntityId %lld"), *Channel->Actor->GetName(), Channel->GetEntityId());
+		EntityCreationScheduler.QueueRequest(Channel, MoveTemp(ComponentDatas), GetEntityCreationPriority(Channel->Actor));
+		return;
+	}
+
 	UE_LOG(LogSpatialSender, Log, TEXT("Sending create entity request for %s with EntityId %lld"), *Channel->Actor->GetName(), Channel->GetEntityId());
 
-	Worker_RequestId RequestId = CreateEntity(Channel);
+	Worker_RequestId RequestId = CreateEntity(Channel, MoveTemp(ComponentDatas));
 	Receiver->AddPendingActorRequest(RequestId, Channel);
 }
 
+void USpatialSender::FlushCreateEntityRequests()
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpatialSenderFlushCreateEntityRequests);
+
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+	EntityCreationScheduler.SetBudget(SpatialGDKSettings->EntityCreationRequestsPerSecond, SpatialGDKSettings->EntityCreationBytesPerSecond);
+
+	if (EntityCreationScheduler.Num() == 0)
+	{
+		return;
+	}
+
+	EntityCreationScheduler.Flush(FPlatformTime::Seconds(), [this](USpatialActorChannel* Channel, TArray<Worker_ComponentData>&& ComponentDatas)
+	{
+		UE_LOG(LogSpatialSender, Log, TEXT("Sending create entity request for %s with EntityId %lld"), *Channel->Actor->GetName(), Channel->GetEntityId());
+
+		Worker_RequestId RequestId = CreateEntity(Channel, MoveTemp(ComponentDatas));
+		Receiver->AddPendingActorRequest(RequestId, Channel);
+	});
+}
+
 void USpatialSender::SendDeleteEntityRequest(Worker_EntityId EntityId)
 {
+	// Updates to an entity that is about to be deleted would only fail.
+	UpdateCoalescer.DiscardUpdatesForEntity(EntityId);
+	ForgetSentInterest(EntityId);
 	Connection->SendDeleteEntityRequest(EntityId);
 }
 
@@ -1257,15 +1439,21 @@ bool USpatialSender::AddPendingRPC(UObject* TargetObject, const FPendingRPCParam
 		return false;
 	}
 
-	TSet<TWeakObjectPtr<const UObject>> UnresolvedObjects;
+	Worker_ComponentUpdate* PackedUpdate = PackedRPCUpdates.Find(ControllerObjectRef.Entity);
+	if (PackedUpdate == nullptr)
+	{
+		Worker_ComponentUpdate ComponentUpdate = {};
+		ComponentUpdate.component_id = NetDriver->IsServer() ? SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID : SpatialConstants::CLIENT_RPC_ENDPOINT_COMPONENT_ID;
+		ComponentUpdate.schema_type = Schema_CreateComponentUpdate(ComponentUpdate.component_id);
+		PackedUpdate = &PackedRPCUpdates.Add(ControllerObjectRef.Entity, ComponentUpdate);
+	}
 
-	FPendingRPC RPC;
-	RPC.Offset = TargetObjectRef.Offset;
-	RPC.Index = RPCIndex;
-	RPC.Data.SetNumUninitialized(Parameters.Payload.PayloadData.Num());
-	FMemory::Memcpy(RPC.Data.GetData(), Parameters.Payload.PayloadData.GetData(), Parameters.Payload.PayloadData.Num());
-	RPC.Entity = TargetObjectRef.Entity;
-	RPCsToPack.FindOrAdd(ControllerObjectRef.Entity).Emplace(MoveTemp(RPC));
+	// The payload is copied straight into the update's schema memory, rather than into an intermediate array that
+	// would be copied again when the update is built at the end of the frame.
+	Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(PackedUpdate->schema_type);
+	Schema_Object* EventData = Schema_AddObject(EventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_PACKED_EVENT_ID);
+	RPCPayload::WriteToSchemaObject(EventData, TargetObjectRef.Offset, RPCIndex, Parameters.Payload.PayloadData.GetData(), Parameters.Payload.PayloadData.Num());
+	Schema_AddEntityId(EventData, SpatialConstants::UNREAL_PACKED_RPC_PAYLOAD_ENTITY_ID, TargetObjectRef.Entity);
 	return true;
 }
 
@@ -1359,7 +1547,7 @@ void USpatialSender::ResolveOutgoingOperations(UObject* Object, bool bIsHandover
 void USpatialSender::SendOutgoingRPCs()
 {
 	FProcessRPCDelegate Delegate;
-	Delegate.BindUObject(this, &USpatialSender::SendRPC);
+	Delegate.BindUObject(this, &USpatialSender::SendQueuedRPC);
 	OutgoingRPCs.ProcessRPCs(Delegate);
 }
 
@@ -1396,7 +1584,36 @@ void USpatialSender::UpdateInterestComponent(AActor* Actor)
 	Worker_ComponentUpdate Update = InterestUpdateFactory.CreateInterestUpdate();
 
 	Worker_EntityId EntityId = PackageMap->GetEntityIdFromObject(Actor);
-	Connection->SendComponentUpdate(EntityId, &Update);
+	if (!HasInterestChanged(EntityId, Schema_GetComponentUpdateFields(Update.schema_type)))
+	{
+		Schema_DestroyComponentUpdate(Update.schema_type);
+		return;
+	}
+
+	SendOrCoalesceComponentUpdate(EntityId, Update);
+}
+
+bool USpatialSender::HasInterestChanged(Worker_EntityId EntityId, Schema_Object* InterestFields)
+{
+	const uint32 Length = Schema_GetWriteBufferLength(InterestFields);
+	TArray<uint8> Buffer;
+	Buffer.SetNumUninitialized(Length);
+	Schema_WriteToBuffer(InterestFields, Buffer.GetData());
+	const uint64 InterestHash = CityHash64(reinterpret_cast<const char*>(Buffer.GetData()), Length);
+
+	uint64& LastInterestHash = SentInterestHashes.FindOrAdd(EntityId);
+	if (LastInterestHash == InterestHash)
+	{
+		return false;
+	}
+
+	LastInterestHash = InterestHash;
+	return true;
+}
+
+void USpatialSender::ForgetSentInterest(Worker_EntityId EntityId)
+{
+	SentInterestHashes.Remove(EntityId);
 }
 
 void USpatialSender::ProcessRPC(FPendingRPCParamsPtr Params)
@@ -2,6 +2,7 @@
 
 #include "Interop/SpatialStaticComponentView.h"
 
+#include "Interop/DecodedOps.h"
 #include "Schema/Component.h"
 #include "Schema/Heartbeat.h"
 #include "Schema/Interest.h"
@@ -11,12 +12,15 @@
 
 Worker_Authority USpatialStaticComponentView::GetAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
 {
-	if (TMap<Worker_ComponentId, Worker_Authority>* ComponentAuthorityMap = EntityComponentAuthorityMap.Find(EntityId))
+	const int32 EntitySlot = FindEntitySlot(EntityId);
+	if (EntitySlot == INDEX_NONE)
 	{
-		if (Worker_Authority* Authority = ComponentAuthorityMap->Find(ComponentId))
-		{
-			return *Authority;
-		}
+		return WORKER_AUTHORITY_NOT_AUTHORITATIVE;
+	}
+
+	if (SpatialGDK::ComponentColumnBase* Column = FindColumn(ComponentId))
+	{
+		return Column->GetAuthority(EntitySlot);
 	}
 
 	return WORKER_AUTHORITY_NOT_AUTHORITATIVE;
@@ -30,9 +34,15 @@ bool USpatialStaticComponentView::HasAuthority(Worker_EntityId EntityId, Worker_
 
 bool USpatialStaticComponentView::HasComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
 {
-	if (auto* EntityComponentStorage = EntityComponentMap.Find(EntityId))
+	const int32 EntitySlot = FindEntitySlot(EntityId);
+	if (EntitySlot == INDEX_NONE)
 	{
-		return EntityComponentStorage->Contains(ComponentId);
+		return false;
+	}
+
+	if (SpatialGDK::ComponentColumnBase* Column = FindColumn(ComponentId))
+	{
+		return Column->Contains(EntitySlot);
 	}
 
 	return false;
@@ -40,67 +50,53 @@ bool USpatialStaticComponentView::HasComponent(Worker_EntityId EntityId, Worker_
 
 void USpatialStaticComponentView::OnAddComponent(const Worker_AddComponentOp& Op)
 {
-	TUniquePtr<SpatialGDK::ComponentStorageBase> Data;
-	switch (Op.data.component_id)
-	{
-	case SpatialConstants::ENTITY_ACL_COMPONENT_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::EntityAcl>>(Op.data);
-		break;
-	case SpatialConstants::METADATA_COMPONENT_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::Metadata>>(Op.data);
-		break;
-	case SpatialConstants::POSITION_COMPONENT_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::Position>>(Op.data);
-		break;
-	case SpatialConstants::PERSISTENCE_COMPONENT_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::Persistence>>(Op.data);
-		break;
-	case SpatialConstants::SPAWN_DATA_COMPONENT_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::SpawnData>>(Op.data);
-		break;
-	case SpatialConstants::SINGLETON_COMPONENT_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::Singleton>>(Op.data);
-		break;
-	case SpatialConstants::UNREAL_METADATA_COMPONENT_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::UnrealMetadata>>(Op.data);
-		break;
-	case SpatialConstants::INTEREST_COMPONENT_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::Interest>>(Op.data);
-		break;
-	case SpatialConstants::HEARTBEAT_COMPONENT_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::Heartbeat>>(Op.data);
-		break;
-	case SpatialConstants::RPCS_ON_ENTITY_CREATION_ID:
-		Data = MakeUnique<SpatialGDK::ComponentStorage<SpatialGDK::RPCsOnEntityCreation>>(Op.data);
-		break;
-	default:
-		// Component is not hand written, but we still want to know the existence of it on this entity.
-		Data = nullptr;
-	}
-	EntityComponentMap.FindOrAdd(Op.entity_id).FindOrAdd(Op.data.component_id) = std::move(Data);
+	const int32 EntitySlot = FindOrAddEntitySlot(Op.entity_id);
+	FindOrAddColumn(Op.data.component_id).Add(EntitySlot, Op.data);
+	EntityRecords[EntitySlot].ComponentIds.AddUnique(Op.data.component_id);
 }
 
 void USpatialStaticComponentView::OnRemoveComponent(const Worker_RemoveComponentOp& Op)
 {
-	if (auto* ComponentMap = EntityComponentMap.Find(Op.entity_id))
+	const int32 EntitySlot = FindEntitySlot(Op.entity_id);
+	if (EntitySlot == INDEX_NONE)
 	{
-		ComponentMap->Remove(Op.component_id);
+		return;
 	}
 
-	if (auto* AuthorityMap = EntityComponentAuthorityMap.Find(Op.entity_id))
+	if (SpatialGDK::ComponentColumnBase* Column = FindColumn(Op.component_id))
 	{
-		AuthorityMap->Remove(Op.component_id);
+		Column->Remove(EntitySlot);
 	}
+
+	EntityRecords[EntitySlot].ComponentIds.RemoveSwap(Op.component_id);
 }
 
 void USpatialStaticComponentView::OnRemoveEntity(Worker_EntityId EntityId)
 {
-	EntityComponentMap.Remove(EntityId);
-	EntityComponentAuthorityMap.Remove(EntityId);
+	int32 EntitySlot = INDEX_NONE;
+	if (!EntitySlots.RemoveAndCopyValue(EntityId, EntitySlot))
+	{
+		return;
+	}
+
+	FEntityRecord& Record = EntityRecords[EntitySlot];
+	for (Worker_ComponentId ComponentId : Record.ComponentIds)
+	{
+		FindColumn(ComponentId)->Remove(EntitySlot);
+	}
+	Record.ComponentIds.Reset();
+
+	FreeEntitySlots.Add(EntitySlot);
 }
 
-void USpatialStaticComponentView::OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
+void USpatialStaticComponentView::OnComponentUpdate(const Worker_ComponentUpdateOp& Op, SpatialGDK::FDecodedComponentUpdate* DecodedUpdate)
 {
+	if (DecodedUpdate != nullptr)
+	{
+		ApplyDecodedComponentUpdate(Op, *DecodedUpdate);
+		return;
+	}
+
 	SpatialGDK::Component* Component = nullptr;
 
 	switch (Op.update.component_id)
@@ -120,7 +116,113 @@ void USpatialStaticComponentView::OnComponentUpdate(const Worker_ComponentUpdate
 	}
 }
 
+void USpatialStaticComponentView::ApplyDecodedComponentUpdate(const Worker_ComponentUpdateOp& Op, SpatialGDK::FDecodedComponentUpdate& DecodedUpdate)
+{
+	switch (Op.update.component_id)
+	{
+	case SpatialConstants::ENTITY_ACL_COMPONENT_ID:
+		if (SpatialGDK::EntityAcl* EntityAcl = GetComponentData<SpatialGDK::EntityAcl>(Op.entity_id))
+		{
+			if (DecodedUpdate.ReadAcl.IsSet())
+			{
+				EntityAcl->ReadAcl = MoveTemp(DecodedUpdate.ReadAcl.GetValue());
+			}
+
+			// This is never emptied, so does not need an additional check for cleared fields
+			if (DecodedUpdate.ComponentWriteAcl.IsSet())
+			{
+				EntityAcl->ComponentWriteAcl = MoveTemp(DecodedUpdate.ComponentWriteAcl.GetValue());
+			}
+		}
+		break;
+	case SpatialConstants::POSITION_COMPONENT_ID:
+		if (SpatialGDK::Position* Position = GetComponentData<SpatialGDK::Position>(Op.entity_id))
+		{
+			if (DecodedUpdate.Coords.IsSet())
+			{
+				Position->Coords = DecodedUpdate.Coords.GetValue();
+			}
+		}
+		break;
+	default:
+		break;
+	}
+}
+
 void USpatialStaticComponentView::OnAuthorityChange(const Worker_AuthorityChangeOp& Op)
 {
-	EntityComponentAuthorityMap.FindOrAdd(Op.entity_id).FindOrAdd(Op.component_id) = (Worker_Authority)Op.authority;
+	const int32 EntitySlot = FindOrAddEntitySlot(Op.entity_id);
+	FindOrAddColumn(Op.component_id).SetAuthority(EntitySlot, (Worker_Authority)Op.authority);
+	EntityRecords[EntitySlot].ComponentIds.AddUnique(Op.component_id);
+}
+
+int32 USpatialStaticComponentView::FindOrAddEntitySlot(Worker_EntityId EntityId)
+{
+	if (const int32* ExistingSlot = EntitySlots.Find(EntityId))
+	{
+		return *ExistingSlot;
+	}
+
+	const int32 EntitySlot = FreeEntitySlots.Num() > 0 ? FreeEntitySlots.Pop(false) : EntityRecords.AddDefaulted();
+	EntitySlots.Add(EntityId, EntitySlot);
+	return EntitySlot;
+}
+
+SpatialGDK::ComponentColumnBase& USpatialStaticComponentView::FindOrAddColumn(Worker_ComponentId ComponentId)
+{
+	if (SpatialGDK::ComponentColumnBase* Column = FindColumn(ComponentId))
+	{
+		return *Column;
+	}
+
+	TUniquePtr<SpatialGDK::ComponentColumnBase> Column;
+	switch (ComponentId)
+	{
+	case SpatialConstants::ENTITY_ACL_COMPONENT_ID:
+		Column = MakeUnique<SpatialGDK::ComponentColumn<SpatialGDK::EntityAcl>>();
+		break;
+	case SpatialConstants::METADATA_COMPONENT_ID:
+		Column = MakeUnique<SpatialGDK::ComponentColumn<SpatialGDK::Metadata>>();
+		break;
+	case SpatialConstants::POSITION_COMPONENT_ID:
+		Column = MakeUnique<SpatialGDK::ComponentColumn<SpatialGDK::Position>>();
+		break;
+	case SpatialConstants::PERSISTENCE_COMPONENT_ID:
+		Column = MakeUnique<SpatialGDK::ComponentColumn<SpatialGDK::Persistence>>();
+		break;
+	case SpatialConstants::SPAWN_DATA_COMPONENT_ID:
+		Column = MakeUnique<SpatialGDK::ComponentColumn<SpatialGDK::SpawnData>>();
+		break;
+	case SpatialConstants::SINGLETON_COMPONENT_ID:
+		Column = MakeUnique<SpatialGDK::ComponentColumn<SpatialGDK::Singleton>>();
+		break;
+	case SpatialConstants::UNREAL_METADATA_COMPONENT_ID:
+		Column = MakeUnique<SpatialGDK::ComponentColumn<SpatialGDK::UnrealMetadata>>();
+		break;
+	case SpatialConstants::INTEREST_COMPONENT_ID:
+		Column = MakeUnique<SpatialGDK::ComponentColumn<SpatialGDK::Interest>>();
+		break;
+	case SpatialConstants::HEARTBEAT_COMPONENT_ID:
+		Column = MakeUnique<SpatialGDK::ComponentColumn<SpatialGDK::Heartbeat>>();
+		break;
+	case SpatialConstants::RPCS_ON_ENTITY_CREATION_ID:
+		Column = MakeUnique<SpatialGDK::ComponentColumn<SpatialGDK::RPCsOnEntityCreation>>();
+		break;
+	default:
+		// Component is not hand written, but we still want to know the existence of it on this entity.
+		Column = MakeUnique<SpatialGDK::ComponentColumnBase>();
+	}
+
+	if (ColumnIndexByComponentId.Num() <= static_cast<int32>(ComponentId))
+	{
+		const int32 OldNum = ColumnIndexByComponentId.Num();
+		ColumnIndexByComponentId.SetNumUninitialized(ComponentId + 1);
+		for (int32 Index = OldNum; Index < ColumnIndexByComponentId.Num(); Index++)
+		{
+			ColumnIndexByComponentId[Index] = INDEX_NONE;
+		}
+	}
+
+	ColumnIndexByComponentId[ComponentId] = Columns.Add(MoveTemp(Column));
+	return *Columns.Last();
 }
@@ -15,16 +15,39 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, EntityPoolInitialReservationCount(3000)
 	, EntityPoolRefreshThreshold(1000)
 	, EntityPoolRefreshCount(2000)
+	, EntityPoolReservationLeadTimeSeconds(0.0f)
+	, EntityPoolMaxPendingReservations(1)
 	, HeartbeatIntervalSeconds(2.0f)
 	, HeartbeatTimeoutSeconds(10.0f)
 	, ActorReplicationRateLimit(0)
+	, ReplicationBytesPerTick(0)
 	, EntityCreationRateLimit(0)
+	, EntityCreationRequestsPerSecond(0)
+	, EntityCreationBytesPerSecond(0)
 	, OpsUpdateRate(1000.0f)
+	, bWakeOpsThreadOnDemand(false)
+	, OpListTimeoutMs(33)
+	, OutgoingMessageQueueCapacity(16384)
+	, bPreDecodeComponentUpdates(false)
 	, bEnableHandover(true)
 	, MaxNetCullDistanceSquared(900000000.0f) // Set to twice the default Actor NetCullDistanceSquared (300m)
+	, bUseRelevancyGrid(false)
+	, RelevancyGridCellSize(10000.0f) // 100m
+	, bParallelPropertyComparison(false)
+	, QueuedUnreliableRPCTimeToLive(0.0f)
+	, MaxQueuedUnreliableRPCsPerEntity(0)
+	, bPrebuildClassInfo(false)
+	, bPrebuildClassInfoInBackground(false)
+	, bUseDirtyActorReplication(false)
 	, bUsingQBI(true)
 	, PositionUpdateFrequency(1.0f)
 	, PositionDistanceThreshold(100.0f) // 1m (100cm)
+	, bUsePositionStream(false)
+	, PositionStreamCellSize(10000.0f) // 100m, about 1.5mm precision
+	, PositionStreamPositionUpdateFrequency(0.5f)
+	, SnapshotLoadChunkSize(1000)
+	, SnapshotLoadEntitiesPerSecond(0)
+	, WorldWipeMaxDeletesInFlight(1000)
 	, bEnableMetrics(true)
 	, bEnableMetricsDisplay(false)
 	, MetricsReportRate(2.0f)
@@ -34,6 +57,7 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, MaxDynamicallyAttachedSubobjectsPerClass(3)
 	, bEnableServerQBI(bUsingQBI)
 	, bPackRPCs(true)
+	, bCoalesceComponentUpdates(false)
 	, bUseDevelopmentAuthenticationFlow(false)
 	, DefaultWorkerType(FWorkerType(SpatialConstants::DefaultServerWorkerType))
 	, bEnableOffloading(false)
@@ -15,6 +15,7 @@
 #include "SpatialConstants.h"
 #include "Utils/RepLayoutUtils.h"
 #include "Utils/InterestFactory.h"
+#include "Utils/SchemaScratch.h"
 
 namespace SpatialGDK
 {
@@ -23,6 +24,7 @@ ComponentFactory::ComponentFactory(FUnresolvedObjectsMap& RepUnresolvedObjectsMa
 	: NetDriver(InNetDriver)
 	, PackageMap(InNetDriver->PackageMap)
 	, ClassInfoManager(InNetDriver->ClassInfoManager)
+	, Scratch(*InNetDriver->SchemaScratch)
 	, PendingRepUnresolvedObjectsMap(RepUnresolvedObjectsMap)
 	, PendingHandoverUnresolvedObjectsMap(HandoverUnresolvedObjectsMap)
 	, bInterestHasChanged(bInterestDirty)
@@ -56,13 +58,15 @@ bool ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObject*
 					// Check if this is a FastArraySerializer array and if so, call our custom delta serialization
 					if (UScriptStruct* NetDeltaStruct = GetFastArraySerializerProperty(ArrayProperty))
 					{
-						FSpatialNetBitWriter ValueDataWriter(PackageMap, UnresolvedObjects);
+						FSpatialNetBitWriter& ValueDataWriter = Scratch.BeginWrite();
 
 						if (FSpatialNetDeltaSerializeInfo::DeltaSerializeWrite(NetDriver, ValueDataWriter, Object, Parent.ArrayIndex, Parent.Property, NetDeltaStruct) || bIsInitialData)
 						{
 							AddBytesToSchema(ComponentObject, HandleIterator.Handle, ValueDataWriter);
 						}
 
+						Scratch.EndWrite(UnresolvedObjects);
+
 						bProcessedFastArrayProperty = true;
 					}
 				}
@@ -141,7 +145,7 @@ void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId
 	if (UStructProperty* StructProperty = Cast<UStructProperty>(Property))
 	{
 		UScriptStruct* Struct = StructProperty->Struct;
-		FSpatialNetBitWriter ValueDataWriter(PackageMap, UnresolvedObjects);
+		FSpatialNetBitWriter& ValueDataWriter = Scratch.BeginWrite();
 		bool bHasUnmapped = false;
 
 		if (Struct->StructFlags & STRUCT_NetSerializeNative)
@@ -158,6 +162,7 @@ void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId
 			if (!bSuccess)
 			{
 				UE_LOG(LogSpatialNetSerialize, Warning, TEXT("AddProperty: NetSerialize %s failed."), *Struct->GetFullName());
+				Scratch.EndWrite(UnresolvedObjects);
 				return;
 			}
 		}
@@ -169,6 +174,7 @@ void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId
 		}
 
 		AddBytesToSchema(Object, FieldId, ValueDataWriter);
+		Scratch.EndWrite(UnresolvedObjects);
 	}
 	else if (UBoolProperty* BoolProperty = Cast<UBoolProperty>(Property))
 	{
@@ -347,6 +353,7 @@ Worker_ComponentData ComponentFactory::CreateComponentData(Worker_ComponentId Co
 	Worker_ComponentData ComponentData = {};
 	ComponentData.component_id = ComponentId;
 	ComponentData.schema_type = Schema_CreateComponentData(ComponentId);
+	Scratch.CountSchemaObjectCreated();
 	Schema_Object* ComponentObject = Schema_GetComponentDataFields(ComponentData.schema_type);
 
 	// We're currently ignoring ClearedId fields, which is problematic if the initial replicated state
@@ -368,6 +375,7 @@ Worker_ComponentData ComponentFactory::CreateEmptyComponentData(Worker_Component
 Worker_ComponentData ComponentFactory::CreateHandoverComponentData(Worker_ComponentId ComponentId, UObject* Object, const FClassInfo& Info, const FHandoverChangeState& Changes)
 {
 	Worker_ComponentData ComponentData = CreateEmptyComponentData(ComponentId);
+	Scratch.CountSchemaObjectCreated();
 	Schema_Object* ComponentObject = Schema_GetComponentDataFields(ComponentData.schema_type);
 
 	FillHandoverSchemaObject(ComponentObject, Object, Info, Changes, true);
@@ -431,6 +439,7 @@ Worker_ComponentUpdate ComponentFactory::CreateComponentUpdate(Worker_ComponentI
 
 	ComponentUpdate.component_id = ComponentId;
 	ComponentUpdate.schema_type = Schema_CreateComponentUpdate(ComponentId);
+	Scratch.CountSchemaObjectCreated();
 	Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(ComponentUpdate.schema_type);
 
 	TArray<Schema_FieldId> ClearedIds;
@@ -456,6 +465,7 @@ Worker_ComponentUpdate ComponentFactory::CreateHandoverComponentUpdate(Worker_Co
 
 	ComponentUpdate.component_id = ComponentId;
 	ComponentUpdate.schema_type = Schema_CreateComponentUpdate(ComponentId);
+	Scratch.CountSchemaObjectCreated();
 	Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(ComponentUpdate.schema_type);
 
 	TArray<Schema_FieldId> ClearedIds;
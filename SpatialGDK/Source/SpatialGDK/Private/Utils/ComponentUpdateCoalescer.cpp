@@ -0,0 +1,221 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ComponentUpdateCoalescer.h"
+
+#include "Interop/Connection/SpatialWorkerConnection.h"
+
+namespace
+{
+
+void MergeSchemaObject(Schema_Object* Source, Schema_Object* Target)
+{
+	uint32 Length = Schema_GetWriteBufferLength(Source);
+	if (Length == 0)
+	{
+		return;
+	}
+
+	uint8_t* Buffer = Schema_AllocateBuffer(Target, Length);
+	Schema_WriteToBuffer(Source, Buffer);
+	Schema_MergeFromBuffer(Target, Buffer, Length);
+}
+
+} // anonymous namespace
+
+FComponentUpdateCoalescer::~FComponentUpdateCoalescer()
+{
+	for (FPendingUpdate& Pending : PendingUpdates)
+	{
+		Schema_DestroyComponentUpdate(Pending.Update.schema_type);
+	}
+}
+
+template <typename PredicateType>
+void FComponentUpdateCoalescer::RemoveUpdates(PredicateType Predicate, bool bSend)
+{
+	int32 NumKept = 0;
+	for (int32 i = 0; i < PendingUpdates.Num(); i++)
+	{
+		FPendingUpdate& Pending = PendingUpdates[i];
+		if (!Predicate(Pending))
+		{
+			PendingUpdates[NumKept++] = Pending;
+		}
+		else if (bSend)
+		{
+			Connection->SendComponentUpdate(Pending.EntityId, &Pending.Update);
+			SentCount++;
+		}
+		else
+		{
+			Schema_DestroyComponentUpdate(Pending.Update.schema_type);
+		}
+	}
+
+	PendingUpdates.SetNum(NumKept, /* bAllowShrinking */ false);
+
+	// Removal shifted the remaining updates, so rebuild the indices.
+	PendingUpdateIndices.Reset();
+	LastPendingUpdateIndices.Reset();
+	for (int32 i = 0; i < PendingUpdates.Num(); i++)
+	{
+		PendingUpdateIndices.Add(FEntityComponent(PendingUpdates[i].EntityId, PendingUpdates[i].Update.component_id), i);
+		LastPendingUpdateIndices.Add(PendingUpdates[i].EntityId, i);
+	}
+}
+
+void FComponentUpdateCoalescer::Init(USpatialWorkerConnection* InConnection)
+{
+	Connection = InConnection;
+}
+
+void FComponentUpdateCoalescer::QueueUpdate(Worker_EntityId EntityId, Worker_ComponentUpdate& Update)
+{
+	QueuedCount++;
+
+	const FEntityComponent Key(EntityId, Update.component_id);
+	if (int32* PendingIndex = PendingUpdateIndices.Find(Key))
+	{
+		if (LastPendingUpdateIndices.FindChecked(EntityId) == *PendingIndex)
+		{
+			MergeComponentUpdate(Update.schema_type, PendingUpdates[*PendingIndex].Update);
+			Schema_DestroyComponentUpdate(Update.schema_type);
+			Update.schema_type = nullptr;
+			return;
+		}
+
+		// Merging would move this update ahead of updates to other components of the entity queued after the pending one.
+		FlushUpdatesForEntity(EntityId);
+	}
+
+	PendingUpdateIndices.Add(Key, PendingUpdates.Num());
+	LastPendingUpdateIndices.Add(EntityId, PendingUpdates.Num());
+	PendingUpdates.Add(FPendingUpdate{ EntityId, Update });
+}
+
+void FComponentUpdateCoalescer::FlushUpdatesForEntity(Worker_EntityId EntityId)
+{
+	if (LastPendingUpdateIndices.Contains(EntityId))
+	{
+		RemoveUpdates([EntityId](const FPendingUpdate& Pending) { return Pending.EntityId == EntityId; }, /* bSend */ true);
+	}
+}
+
+void FComponentUpdateCoalescer::DiscardUpdatesForEntity(Worker_EntityId EntityId)
+{
+	if (LastPendingUpdateIndices.Contains(EntityId))
+	{
+		RemoveUpdates([EntityId](const FPendingUpdate& Pending) { return Pending.EntityId == EntityId; }, /* bSend */ false);
+	}
+}
+
+void FComponentUpdateCoalescer::DiscardUpdatesForComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
+{
+	if (PendingUpdateIndices.Contains(FEntityComponent(EntityId, ComponentId)))
+	{
+		RemoveUpdates([EntityId, ComponentId](const FPendingUpdate& Pending)
+		{
+			return Pending.EntityId == EntityId && Pending.Update.component_id == ComponentId;
+		}, /* bSend */ false);
+	}
+}
+
+void FComponentUpdateCoalescer::Flush()
+{
+	for (FPendingUpdate& Pending : PendingUpdates)
+	{
+		Connection->SendComponentUpdate(Pending.EntityId, &Pending.Update);
+	}
+
+	SentCount += PendingUpdates.Num();
+
+	PendingUpdates.Reset();
+	PendingUpdateIndices.Reset();
+	LastPendingUpdateIndices.Reset();
+}
+
+void FComponentUpdateCoalescer::ConsumeCounts(uint32& OutQueuedCount, uint32& OutSentCount)
+{
+	OutQueuedCount = QueuedCount;
+	OutSentCount = SentCount;
+	QueuedCount = 0;
+	SentCount = 0;
+}
+
+void FComponentUpdateCoalescer::MergeComponentUpdate(Schema_ComponentUpdate* Source, Worker_ComponentUpdate& Target)
+{
+	Schema_Object* SourceFields = Schema_GetComponentUpdateFields(Source);
+
+	TArray<Schema_FieldId> FieldIds;
+	FieldIds.SetNumUninitialized(Schema_GetUniqueFieldIdCount(SourceFields));
+	if (FieldIds.Num() > 0)
+	{
+		Schema_GetUniqueFieldIds(SourceFields, FieldIds.GetData());
+	}
+
+	// Fields cleared by the older update but set by the newer one must not stay in the cleared list, or the merged update
+	// would both clear and set them. Cleared fields can't be removed from an update, so the older update is rebuilt without them.
+	TArray<Schema_FieldId> TargetClearedFields;
+	TargetClearedFields.SetNumUninitialized(Schema_GetComponentUpdateClearedFieldCount(Target.schema_type));
+	if (TargetClearedFields.Num() > 0)
+	{
+		Schema_GetComponentUpdateClearedFieldList(Target.schema_type, TargetClearedFields.GetData());
+	}
+
+	const bool bNeedsRebuild = TargetClearedFields.ContainsByPredicate([&FieldIds](Schema_FieldId FieldId)
+	{
+		return FieldIds.Contains(FieldId);
+	});
+
+	if (bNeedsRebuild)
+	{
+		Schema_ComponentUpdate* Rebuilt = Schema_CreateComponentUpdate(Target.component_id);
+		MergeSchemaObject(Schema_GetComponentUpdateFields(Target.schema_type), Schema_GetComponentUpdateFields(Rebuilt));
+		MergeSchemaObject(Schema_GetComponentUpdateEvents(Target.schema_type), Schema_GetComponentUpdateEvents(Rebuilt));
+		TargetClearedFields.RemoveAll([&FieldIds](Schema_FieldId FieldId)
+		{
+			return FieldIds.Contains(FieldId);
+		});
+		for (Schema_FieldId FieldId : TargetClearedFields)
+		{
+			Schema_AddComponentUpdateClearedField(Rebuilt, FieldId);
+		}
+
+		Schema_DestroyComponentUpdate(Target.schema_type);
+		Target.schema_type = Rebuilt;
+	}
+
+	Schema_Object* TargetFields = Schema_GetComponentUpdateFields(Target.schema_type);
+
+	// Fields cleared by the newer update replace whatever the older update set.
+	const uint32 ClearedFieldCount = Schema_GetComponentUpdateClearedFieldCount(Source);
+	if (ClearedFieldCount > 0)
+	{
+		TArray<Schema_FieldId> ClearedFields;
+		ClearedFields.SetNumUninitialized(ClearedFieldCount);
+		Schema_GetComponentUpdateClearedFieldList(Source, ClearedFields.GetData());
+
+		for (Schema_FieldId FieldId : ClearedFields)
+		{
+			Schema_ClearField(TargetFields, FieldId);
+			if (!TargetClearedFields.Contains(FieldId))
+			{
+				Schema_AddComponentUpdateClearedField(Target.schema_type, FieldId);
+			}
+		}
+	}
+
+	// Merging schema objects appends values, so fields set by the newer update are cleared in the older one first.
+	if (FieldIds.Num() > 0)
+	{
+		for (Schema_FieldId FieldId : FieldIds)
+		{
+			Schema_ClearField(TargetFields, FieldId);
+		}
+
+		MergeSchemaObject(SourceFields, TargetFields);
+	}
+
+	// Events from both updates are kept, in order.
+	MergeSchemaObject(Schema_GetComponentUpdateEvents(Source), Schema_GetComponentUpdateEvents(Target.schema_type));
+}
@@ -0,0 +1,129 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/EntityCreationScheduler.h"
+
+#include "EngineClasses/SpatialActorChannel.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Entity Creations Queued"), STAT_SpatialEntityCreationsQueued, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Entity Creation Bytes Sent"), STAT_SpatialEntityCreationBytesSent, STATGROUP_SpatialNet);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Entity Creation Queue Wait (ms)"), STAT_SpatialEntityCreationQueueWait, STATGROUP_SpatialNet);
+
+namespace
+{
+// Most budget that can be saved up while there is nothing to send, in seconds of budget.
+const double MaxBudgetSeconds = 0.25;
+}
+
+FEntityCreationScheduler::~FEntityCreationScheduler()
+{
+	for (TArray<FPendingRequest>& Requests : PendingRequests)
+	{
+		for (FPendingRequest& Request : Requests)
+		{
+			DestroyComponentDatas(Request.ComponentDatas);
+		}
+	}
+}
+
+void FEntityCreationScheduler::SetBudget(uint32 InEntitiesPerSecond, uint32 InBytesPerSecond)
+{
+	EntitiesPerSecond = InEntitiesPerSecond;
+	BytesPerSecond = InBytesPerSecond;
+}
+
+void FEntityCreationScheduler::QueueRequest(USpatialActorChannel* Channel, TArray<Worker_ComponentData>&& ComponentDatas, EEntityCreationPriority Priority)
+{
+	uint32 Size = 0;
+	if (BytesPerSecond > 0)
+	{
+		for (const Worker_ComponentData& ComponentData : ComponentDatas)
+		{
+			Size += Schema_GetWriteBufferLength(Schema_GetComponentDataFields(ComponentData.schema_type));
+		}
+	}
+
+	PendingRequests[static_cast<uint8>(Priority)].Add(FPendingRequest{ Channel, MoveTemp(ComponentDatas), Size, FPlatformTime::Seconds() });
+	INC_DWORD_STAT(STAT_SpatialEntityCreationsQueued);
+}
+
+void FEntityCreationScheduler::Flush(double Now, FSendRequestFunction SendRequest)
+{
+	AccumulateBudget(Now);
+
+	for (TArray<FPendingRequest>& Requests : PendingRequests)
+	{
+		int32 NumProcessed = 0;
+		for (; NumProcessed < Requests.Num(); NumProcessed++)
+		{
+			FPendingRequest& Request = Requests[NumProcessed];
+
+			USpatialActorChannel* Channel = Request.Channel.Get();
+			if (Channel == nullptr || Channel->Closing || Channel->Actor == nullptr || Channel->Actor->IsPendingKill())
+			{
+				DestroyComponentDatas(Request.ComponentDatas);
+				continue;
+			}
+
+			if (!HasBudget())
+			{
+				break;
+			}
+
+			if (EntitiesPerSecond > 0)
+			{
+				EntityBudget -= 1.0;
+			}
+			if (BytesPerSecond > 0)
+			{
+				ByteBudget -= Request.Size;
+			}
+			INC_DWORD_STAT_BY(STAT_SpatialEntityCreationBytesSent, Request.Size);
+			SET_FLOAT_STAT(STAT_SpatialEntityCreationQueueWait, (Now - Request.QueuedTime) * 1000.0);
+
+			SendRequest(Channel, MoveTemp(Request.ComponentDatas));
+		}
+
+		Requests.RemoveAt(0, NumProcessed, /* bAllowShrinking */ false);
+		DEC_DWORD_STAT_BY(STAT_SpatialEntityCreationsQueued, NumProcessed);
+
+		if (Requests.Num() > 0)
+		{
+			// Lower priorities wait until this one is empty.
+			return;
+		}
+	}
+}
+
+int32 FEntityCreationScheduler::Num() const
+{
+	int32 Count = 0;
+	for (const TArray<FPendingRequest>& Requests : PendingRequests)
+	{
+		Count += Requests.Num();
+	}
+	return Count;
+}
+
+void FEntityCreationScheduler::DestroyComponentDatas(TArray<Worker_ComponentData>& ComponentDatas)
+{
+	for (Worker_ComponentData& ComponentData : ComponentDatas)
+	{
+		Schema_DestroyComponentData(ComponentData.schema_type);
+	}
+	ComponentDatas.Empty();
+}
+
+bool FEntityCreationScheduler::HasBudget() const
+{
+	return (EntitiesPerSecond == 0 || EntityBudget >= 1.0) && (BytesPerSecond == 0 || ByteBudget > 0.0);
+}
+
+void FEntityCreationScheduler::AccumulateBudget(double Now)
+{
+	const double Elapsed = (LastFlushTime > 0.0) ? Now - LastFlushTime : MaxBudgetSeconds;
+	LastFlushTime = Now;
+
+	// Always allow at least one entity to be saved up, so that budgets below one entity per flush still make progress.
+	EntityBudget = FMath::Min(EntityBudget + Elapsed * EntitiesPerSecond, FMath::Max(1.0, EntitiesPerSecond * MaxBudgetSeconds));
+	ByteBudget = FMath::Min(ByteBudget + Elapsed * BytesPerSecond, BytesPerSecond * MaxBudgetSeconds);
+}
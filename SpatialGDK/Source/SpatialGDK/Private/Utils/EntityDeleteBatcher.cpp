@@ -0,0 +1,37 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/EntityDeleteBatcher.h"
+
+#include "EngineClasses/SpatialNetDriver.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Entity Deletes In Flight"), STAT_SpatialEntityDeletesInFlight, STATGROUP_SpatialNet);
+
+FEntityDeleteBatcher::FEntityDeleteBatcher(TArray<Worker_EntityId>&& InEntityIds, int32 InMaxInFlight)
+	: EntityIds(MoveTemp(InEntityIds))
+	, MaxInFlight(FMath::Max(1, InMaxInFlight))
+{
+}
+
+void FEntityDeleteBatcher::SendRequests(FSendDeleteFunction SendDelete)
+{
+	const int32 NumToSend = FMath::Min(EntityIds.Num() - NumSent, MaxInFlight - GetNumInFlight());
+	for (int32 i = 0; i < NumToSend; i++)
+	{
+		SendDelete(EntityIds[NumSent++]);
+	}
+
+	INC_DWORD_STAT_BY(STAT_SpatialEntityDeletesInFlight, FMath::Max(0, NumToSend));
+}
+
+void FEntityDeleteBatcher::OnDeleteResponse(bool bSucceeded)
+{
+	check(GetNumInFlight() > 0);
+
+	NumResponses++;
+	if (!bSucceeded)
+	{
+		NumFailed++;
+	}
+
+	DEC_DWORD_STAT(STAT_SpatialEntityDeletesInFlight);
+}
@@ -9,13 +9,29 @@
 
 DEFINE_LOG_CATEGORY(LogSpatialEntityPool);
 
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Entity Pool Available IDs"), STAT_SpatialEntityPoolAvailableIds, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Entity Pool Pending Reservations"), STAT_SpatialEntityPoolPendingReservations, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Entity Pool Requests While Empty"), STAT_SpatialEntityPoolRequestsWhileEmpty, STATGROUP_SpatialNet);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Entity Pool Time Empty (ms)"), STAT_SpatialEntityPoolTimeEmpty, STATGROUP_SpatialNet);
+
 using namespace SpatialGDK;
 
+namespace
+{
+const double AllocationRateSampleSeconds = 1.0;
+
+int64 GetNumRemainingEntityIds(const EntityRange& Range)
+{
+	return Range.LastEntityId - Range.CurrentEntityId + 1;
+}
+}
+
 void UEntityPool::Init(USpatialNetDriver* InNetDriver, FTimerManager* InTimerManager)
 {
 	NetDriver = InNetDriver;
 	Receiver = InNetDriver->Receiver;
 	TimerManager = InTimerManager;
+	RateSampleStartTime = FPlatformTime::Seconds();
 
 	ReserveEntityIDs(GetDefault<USpatialGDKSettings>()->EntityPoolInitialReservationCount);
 }
@@ -24,12 +40,14 @@ void UEntityPool::ReserveEntityIDs(int32 EntitiesToReserve)
 {
 	UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Sending bulk entity ID Reservation Request for %d IDs"), EntitiesToReserve);
 
-	checkf(!bIsAwaitingResponse, TEXT("Trying to reserve Entity IDs while another reserve request is in flight"));
-
 	// Set up reserve IDs delegate
 	ReserveEntityIDsDelegate CacheEntityIDsDelegate;
 	CacheEntityIDsDelegate.BindLambda([EntitiesToReserve, this](const Worker_ReserveEntityIdsResponseOp& Op)
 	{
+		NumPendingReservations--;
+		NumReservingEntityIds -= EntitiesToReserve;
+		SET_DWORD_STAT(STAT_SpatialEntityPoolPendingReservations, NumPendingReservations);
+
 		if (Op.status_code != WORKER_STATUS_CODE_SUCCESS)
 		{
 			// UNR-630 - Temporary hack to avoid failure to reserve entities due to timeout on large maps
@@ -50,6 +68,13 @@ void UEntityPool::ReserveEntityIDs(int32 EntitiesToReserve)
 		check(EntitiesToReserve == Op.number_of_entity_ids);
 
 		// Clean up any expired Entity ranges
+		for (const EntityRange& Range : ReservedEntityIDRanges)
+		{
+			if (Range.bExpired)
+			{
+				NumAvailableEntityIds -= GetNumRemainingEntityIds(Range);
+			}
+		}
 		ReservedEntityIDRanges = ReservedEntityIDRanges.FilterByPredicate([](const EntityRange& Element)
 		{
 			return !Element.bExpired;
@@ -63,6 +88,16 @@ void UEntityPool::ReserveEntityIDs(int32 EntitiesToReserve)
 		UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Reserved %d entities, caching in pool, Entity IDs: (%d, %d) Range ID: %d"), Op.number_of_entity_ids, Op.first_entity_id, NewEntityRange.LastEntityId, NewEntityRange.EntityRangeId);
 
 		ReservedEntityIDRanges.Add(NewEntityRange);
+		NumAvailableEntityIds += Op.number_of_entity_ids;
+		SET_DWORD_STAT(STAT_SpatialEntityPoolAvailableIds, NumAvailableEntityIds);
+
+		if (EmptySinceTime > 0.0)
+		{
+			const double TimeEmpty = FPlatformTime::Seconds() - EmptySinceTime;
+			UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Entity pool was empty for %.1f ms"), TimeEmpty * 1000.0);
+			INC_FLOAT_STAT_BY(STAT_SpatialEntityPoolTimeEmpty, TimeEmpty * 1000.0);
+			EmptySinceTime = 0.0;
+		}
 
 		FTimerHandle ExpirationTimer;
 		TWeakObjectPtr<UEntityPool> WeakThis(this);
@@ -74,7 +109,6 @@ void UEntityPool::ReserveEntityIDs(int32 EntitiesToReserve)
 			}
 		}, SpatialConstants::ENTITY_RANGE_EXPIRATION_INTERVAL_SECONDS, false);
 
-		bIsAwaitingResponse = false;
 		if (!bIsReady)
 		{
 			bIsReady = true;
@@ -83,7 +117,9 @@ void UEntityPool::ReserveEntityIDs(int32 EntitiesToReserve)
 
 	// Reserve the Entity IDs
 	Worker_RequestId ReserveRequestID = NetDriver->Connection->SendReserveEntityIdsRequest(EntitiesToReserve);
-	bIsAwaitingResponse = true;
+	NumPendingReservations++;
+	NumReservingEntityIds += EntitiesToReserve;
+	SET_DWORD_STAT(STAT_SpatialEntityPoolPendingReservations, NumPendingReservations);
 
 	// Add the spawn delegate
 	Receiver->AddReserveEntityIdsDelegate(ReserveRequestID, CacheEntityIDsDelegate);
@@ -109,12 +145,13 @@ void UEntityPool::OnEntityRangeExpired(uint32 ExpiringEntityRangeId)
 	{
 		// This is not the most recent entity range, just clean up without requesting additional IDs.
 		UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Newer range detected, cleaning up Entity range ID: %d without new request"), ExpiringEntityRangeId);
+		NumAvailableEntityIds -= GetNumRemainingEntityIds(ReservedEntityIDRanges[FoundEntityRangeIndex]);
 		ReservedEntityIDRanges.RemoveAt(FoundEntityRangeIndex);
 	}
 	else
 	{
 		// Reserve then cleanup
-		if (!bIsAwaitingResponse)
+		if (NumPendingReservations == 0)
 		{
 			UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Reserving new Entity range to replace Entity range ID: %d"), ExpiringEntityRangeId);
 			ReserveEntityIDs(GetDefault<USpatialGDKSettings>()->EntityPoolRefreshCount);
@@ -126,34 +163,86 @@ void UEntityPool::OnEntityRangeExpired(uint32 ExpiringEntityRangeId)
 
 Worker_EntityId UEntityPool::GetNextEntityId()
 {
+	const double Now = FPlatformTime::Seconds();
+
+	// Requests made while the pool is empty count towards the allocation rate, so that the next reservation covers them.
+	AllocationsInSample++;
+	UpdateAllocationRate(Now);
+
 	if (ReservedEntityIDRanges.Num() == 0)
 	{
+		if (EmptySinceTime == 0.0)
+		{
+			EmptySinceTime = Now;
+		}
+		INC_DWORD_STAT(STAT_SpatialEntityPoolRequestsWhileEmpty);
+
 		// TODO: Improve error message
 		UE_LOG(LogSpatialEntityPool, Warning, TEXT("Tried to pop an entity ID from the pool when there were no entity IDs. Try altering your Entity Pool configuration"));
+
+		ReserveEntityIDsIfNeeded(Now);
 		return SpatialConstants::INVALID_ENTITY_ID;
 	}
 
 	EntityRange& CurrentEntityRange = ReservedEntityIDRanges[0];
 	Worker_EntityId NextId = CurrentEntityRange.CurrentEntityId++;
+	NumAvailableEntityIds--;
+
+	UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Popped ID, %lld IDs remaining"), NumAvailableEntityIds);
 
-	uint32_t TotalRemainingEntityIds = 0;
-	for (EntityRange Range : ReservedEntityIDRanges)
+	if (CurrentEntityRange.CurrentEntityId > CurrentEntityRange.LastEntityId)
+	{
+		ReservedEntityIDRanges.RemoveAt(0);
+	}
+
+	if (NumAvailableEntityIds == 0)
 	{
-		TotalRemainingEntityIds += Range.LastEntityId - Range.CurrentEntityId + 1;
+		EmptySinceTime = Now;
 	}
+	SET_DWORD_STAT(STAT_SpatialEntityPoolAvailableIds, NumAvailableEntityIds);
+
+	ReserveEntityIDsIfNeeded(Now);
 
-	UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Popped ID, %i IDs remaining"), TotalRemainingEntityIds);
+	return NextId;
+}
+
+void UEntityPool::ReserveEntityIDsIfNeeded(double Now)
+{
+	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+
+	// The IDs expected to be used before a reservation sent now is answered.
+	const int64 PredictedUse = FMath::Min<int64>(static_cast<int64>(GetAllocationRate(Now) * SpatialGDKSettings->EntityPoolReservationLeadTimeSeconds), MAX_int32 / 2);
+	const int64 Threshold = FMath::Max<int64>(SpatialGDKSettings->EntityPoolRefreshThreshold, PredictedUse);
 
-	if (TotalRemainingEntityIds < GetDefault<USpatialGDKSettings>()->EntityPoolRefreshThreshold && !bIsAwaitingResponse)
+	if (NumAvailableEntityIds + NumReservingEntityIds >= Threshold ||
+		NumPendingReservations >= FMath::Max(SpatialGDKSettings->EntityPoolMaxPendingReservations, 1u))
 	{
-		UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Pool under threshold, reserving more entity IDs"));
-		ReserveEntityIDs(GetDefault<USpatialGDKSettings>()->EntityPoolRefreshCount);
+		return;
 	}
 
-	if (CurrentEntityRange.CurrentEntityId > CurrentEntityRange.LastEntityId)
+	UE_LOG(LogSpatialEntityPool, Verbose, TEXT("Pool under threshold, reserving more entity IDs"));
+
+	// Reserving twice the predicted use means a steady spawn rate triggers about one reservation per lead time.
+	ReserveEntityIDs(static_cast<int32>(FMath::Max<int64>(SpatialGDKSettings->EntityPoolRefreshCount, 2 * PredictedUse)));
+}
+
+void UEntityPool::UpdateAllocationRate(double Now)
+{
+	const double Elapsed = Now - RateSampleStartTime;
+	if (Elapsed < AllocationRateSampleSeconds)
 	{
-		ReservedEntityIDRanges.RemoveAt(0);
+		return;
 	}
 
-	return NextId;
+	// Weighted towards the latest sample, so that a wave of spawns is picked up within a couple of samples.
+	AllocationRate = FMath::Lerp(AllocationRate, AllocationsInSample / Elapsed, 0.5);
+	AllocationsInSample = 0;
+	RateSampleStartTime = Now;
+}
+
+double UEntityPool::GetAllocationRate(double Now) const
+{
+	// Also consider the sample in progress, so that a burst is reacted to before its sample completes.
+	const double Elapsed = FMath::Max(Now - RateSampleStartTime, 0.1);
+	return FMath::Max(AllocationRate, AllocationsInSample / Elapsed);
 }
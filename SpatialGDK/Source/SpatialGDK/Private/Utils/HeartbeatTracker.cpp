@@ -0,0 +1,90 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/HeartbeatTracker.h"
+
+#include "EngineClasses/SpatialNetConnection.h"
+
+DECLARE_CYCLE_STAT(TEXT("HeartbeatTracker Scan"), STAT_SpatialHeartbeatTrackerScan, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Heartbeat Connections Tracked"), STAT_SpatialHeartbeatConnectionsTracked, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Heartbeat Timeouts Detected"), STAT_SpatialHeartbeatTimeoutsDetected, STATGROUP_SpatialNet);
+
+int32 FHeartbeatTracker::Add(USpatialNetConnection* Connection, double Now)
+{
+	INC_DWORD_STAT(STAT_SpatialHeartbeatConnectionsTracked);
+
+	if (FreeSlots.Num() > 0)
+	{
+		const int32 Slot = FreeSlots.Pop(/* bAllowShrinking */ false);
+		Connections[Slot] = Connection;
+		LastHeartbeatTimes[Slot] = Now;
+		return Slot;
+	}
+
+	LastHeartbeatTimes.Add(Now);
+	return Connections.Add(Connection);
+}
+
+void FHeartbeatTracker::RecordHeartbeat(int32 Slot, const USpatialNetConnection* Connection, double Now)
+{
+	if (IsSlotFor(Slot, Connection))
+	{
+		LastHeartbeatTimes[Slot] = Now;
+	}
+}
+
+void FHeartbeatTracker::Remove(int32 Slot, const USpatialNetConnection* Connection)
+{
+	if (IsSlotFor(Slot, Connection))
+	{
+		Connections[Slot] = nullptr;
+		FreeSlots.Add(Slot);
+		DEC_DWORD_STAT(STAT_SpatialHeartbeatConnectionsTracked);
+	}
+}
+
+void FHeartbeatTracker::Tick(double Now, double TimeoutSeconds, FOnTimedOut OnTimedOut)
+{
+	if (Now - LastScanTime < ScanIntervalSeconds)
+	{
+		return;
+	}
+	LastScanTime = Now;
+
+	TArray<USpatialNetConnection*, TInlineAllocator<16>> TimedOutConnections;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_SpatialHeartbeatTrackerScan);
+
+		const double OldestAllowedTime = Now - TimeoutSeconds;
+		for (int32 Slot = 0; Slot < LastHeartbeatTimes.Num(); Slot++)
+		{
+			// Free slots are never timed out, as they are only freed after being removed below or by Remove.
+			if (LastHeartbeatTimes[Slot] >= OldestAllowedTime || Connections[Slot].IsExplicitlyNull())
+			{
+				continue;
+			}
+
+			if (USpatialNetConnection* Connection = Connections[Slot].Get())
+			{
+				TimedOutConnections.Add(Connection);
+			}
+
+			Connections[Slot] = nullptr;
+			FreeSlots.Add(Slot);
+			DEC_DWORD_STAT(STAT_SpatialHeartbeatConnectionsTracked);
+		}
+	}
+
+	// Timing out a connection cleans it up, which may remove other connections, so this is done after the scan.
+	INC_DWORD_STAT_BY(STAT_SpatialHeartbeatTimeoutsDetected, TimedOutConnections.Num());
+	for (USpatialNetConnection* Connection : TimedOutConnections)
+	{
+		OnTimedOut(Connection);
+	}
+}
+
+bool FHeartbeatTracker::IsSlotFor(int32 Slot, const USpatialNetConnection* Connection) const
+{
+	// Compared by index and serial number, so this still matches while the connection is being destroyed.
+	return Connections.IsValidIndex(Slot) && !Connections[Slot].IsExplicitlyNull() &&
+		Connections[Slot].HasSameIndexAndSerialNumber(TWeakObjectPtr<const USpatialNetConnection>(Connection));
+}
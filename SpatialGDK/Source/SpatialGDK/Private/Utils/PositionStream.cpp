@@ -0,0 +1,149 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/PositionStream.h"
+
+#include "SpatialConstants.h"
+#include "Utils/SchemaUtils.h"
+
+namespace
+{
+const float MaxQuantizedOffset = 65535.0f;
+
+void WriteVarint(TArray<uint8>& Buffer, uint64 Value)
+{
+	while (Value >= 0x80)
+	{
+		Buffer.Add(static_cast<uint8>(Value) | 0x80);
+		Value >>= 7;
+	}
+	Buffer.Add(static_cast<uint8>(Value));
+}
+
+bool ReadVarint(const uint8*& Data, const uint8* End, uint64& OutValue)
+{
+	OutValue = 0;
+	for (uint32 Shift = 0; Data < End && Shift < 64; Shift += 7)
+	{
+		const uint8 Byte = *Data++;
+		OutValue |= static_cast<uint64>(Byte & 0x7f) << Shift;
+		if ((Byte & 0x80) == 0)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+uint32 ZigZagEncode(int32 Value)
+{
+	return (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+}
+
+int32 ZigZagDecode(uint32 Value)
+{
+	return static_cast<int32>(Value >> 1) ^ -static_cast<int32>(Value & 1);
+}
+} // anonymous namespace
+
+FPositionStream::FPositionStream(float InCellSize)
+	: CellSize(InCellSize)
+{
+}
+
+void FPositionStream::Add(Worker_EntityId EntityId, const FVector& Location)
+{
+	Positions.Add(EntityId, Location);
+}
+
+Worker_ComponentUpdate FPositionStream::CreateUpdate()
+{
+	// Sorting makes the entity id deltas small, so they mostly fit in one or two bytes.
+	Positions.KeySort(TLess<Worker_EntityId_Key>());
+
+	Buffer.Reset();
+	Worker_EntityId PreviousEntityId = 0;
+	for (const TPair<Worker_EntityId_Key, FVector>& Position : Positions)
+	{
+		WriteVarint(Buffer, static_cast<uint64>(Position.Key - PreviousEntityId));
+		PreviousEntityId = Position.Key;
+
+		uint16 Offsets[3];
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			const float Coordinate = Position.Value[Axis];
+			const int32 Cell = FMath::FloorToInt(Coordinate / CellSize);
+			const float Offset = (Coordinate - Cell * CellSize) / CellSize;
+
+			WriteVarint(Buffer, ZigZagEncode(Cell));
+			Offsets[Axis] = static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(Offset * MaxQuantizedOffset), 0, 65535));
+		}
+
+		for (uint16 Offset : Offsets)
+		{
+			Buffer.Add(static_cast<uint8>(Offset));
+			Buffer.Add(static_cast<uint8>(Offset >> 8));
+		}
+	}
+	Positions.Reset();
+
+	Worker_ComponentUpdate Update = {};
+	Update.component_id = SpatialConstants::POSITION_STREAM_COMPONENT_ID;
+	Update.schema_type = Schema_CreateComponentUpdate(SpatialConstants::POSITION_STREAM_COMPONENT_ID);
+	Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
+
+	Schema_AddFloat(ComponentObject, SpatialConstants::POSITION_STREAM_CELL_SIZE_ID, CellSize);
+	SpatialGDK::AddBytesToSchema(ComponentObject, SpatialConstants::POSITION_STREAM_POSITIONS_ID, Buffer.GetData(), Buffer.Num());
+
+	return Update;
+}
+
+Worker_ComponentData FPositionStream::CreateEmptyData(float CellSize)
+{
+	Worker_ComponentData Data = {};
+	Data.component_id = SpatialConstants::POSITION_STREAM_COMPONENT_ID;
+	Data.schema_type = Schema_CreateComponentData(SpatialConstants::POSITION_STREAM_COMPONENT_ID);
+	Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
+
+	Schema_AddFloat(ComponentObject, SpatialConstants::POSITION_STREAM_CELL_SIZE_ID, CellSize);
+	SpatialGDK::AddBytesToSchema(ComponentObject, SpatialConstants::POSITION_STREAM_POSITIONS_ID, nullptr, 0);
+
+	return Data;
+}
+
+void FPositionStream::Read(Schema_Object* ComponentObject, TFunctionRef<void(Worker_EntityId, const FVector&)> Visitor)
+{
+	if (Schema_GetFloatCount(ComponentObject, SpatialConstants::POSITION_STREAM_CELL_SIZE_ID) == 0 ||
+		Schema_GetBytesCount(ComponentObject, SpatialConstants::POSITION_STREAM_POSITIONS_ID) == 0)
+	{
+		return;
+	}
+
+	const float StreamCellSize = Schema_GetFloat(ComponentObject, SpatialConstants::POSITION_STREAM_CELL_SIZE_ID);
+	const uint8* Data = Schema_GetBytes(ComponentObject, SpatialConstants::POSITION_STREAM_POSITIONS_ID);
+	const uint8* End = Data + Schema_GetBytesLength(ComponentObject, SpatialConstants::POSITION_STREAM_POSITIONS_ID);
+
+	Worker_EntityId EntityId = 0;
+	while (Data < End)
+	{
+		uint64 EntityIdDelta = 0;
+		uint64 Cells[3];
+		if (!ReadVarint(Data, End, EntityIdDelta) || !ReadVarint(Data, End, Cells[0]) || !ReadVarint(Data, End, Cells[1]) || !ReadVarint(Data, End, Cells[2]) ||
+			End - Data < 6)
+		{
+			// Truncated or corrupt stream, the rest can't be read.
+			return;
+		}
+
+		EntityId += static_cast<Worker_EntityId>(EntityIdDelta);
+
+		FVector Location;
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			const uint16 Offset = static_cast<uint16>(Data[0] | (Data[1] << 8));
+			Data += 2;
+			Location[Axis] = (ZigZagDecode(static_cast<uint32>(Cells[Axis])) + Offset / MaxQuantizedOffset) * StreamCellSize;
+		}
+
+		Visitor(EntityId, Location);
+	}
+}
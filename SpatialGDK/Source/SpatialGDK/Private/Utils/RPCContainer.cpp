@@ -2,8 +2,13 @@
 
 #include "Utils/RPCContainer.h"
 
+#include "EngineClasses/SpatialNetDriver.h"
 #include "Schema/UnrealObjectRef.h"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("RPCs queued"), STAT_SpatialRPCsQueued, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Queued RPCs dropped"), STAT_SpatialQueuedRPCsDropped, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Queued RPCs expired"), STAT_SpatialQueuedRPCsExpired, STATGROUP_SpatialNet);
+
 using namespace SpatialGDK;
 
 FPendingRPCParams::FPendingRPCParams(const FUnrealObjectRef& InTargetObjectRef, SpatialGDK::RPCPayload&& InPayload, int InReliableRPCIndex /* = 0 */)
@@ -13,40 +18,149 @@ FPendingRPCParams::FPendingRPCParams(const FUnrealObjectRef& InTargetObjectRef,
 {
 }
 
+void FRPCContainer::FRPCQueue::Push(FPendingRPCParamsPtr Params)
+{
+	if (Count == Slots.Num())
+	{
+		TArray<FPendingRPCParamsPtr> NewSlots;
+		NewSlots.SetNum(FMath::Max(4, Slots.Num() * 2));
+		for (int32 i = 0; i < Count; i++)
+		{
+			NewSlots[i] = MoveTemp(Slots[(Head + i) & (Slots.Num() - 1)]);
+		}
+		Slots = MoveTemp(NewSlots);
+		Head = 0;
+	}
+
+	Slots[(Head + Count) & (Slots.Num() - 1)] = MoveTemp(Params);
+	Count++;
+}
+
+FPendingRPCParamsPtr FRPCContainer::FRPCQueue::Pop()
+{
+	check(Count > 0);
+	FPendingRPCParamsPtr Params = MoveTemp(Slots[Head]);
+	Head = (Head + 1) & (Slots.Num() - 1);
+	Count--;
+	return Params;
+}
+
+void FRPCContainer::SetQueueLimits(ESchemaComponentType Type, float TimeToLive, uint32 MaxDepth)
+{
+	FQueueLimits& Limits = QueueLimits.FindOrAdd(Type);
+	Limits.TimeToLive = TimeToLive;
+	Limits.MaxDepth = MaxDepth;
+}
+
 void FRPCContainer::QueueRPC(FPendingRPCParamsPtr Params, ESchemaComponentType Type)
 {
-	FArrayOfParams& ArrayOfParams = QueuedRPCs.FindOrAdd(Type).FindOrAdd(Params->ObjectRef.Entity);
-	ArrayOfParams.Push(MoveTemp(Params));
+	const Worker_EntityId EntityId = Params->ObjectRef.Entity;
+	Params->QueuedTime = FPlatformTime::Seconds();
+
+	// RPCs to an entity that is blocked join its blocked queue, so they stay behind the RPCs already waiting.
+	FRPCQueue* RPCQueue = nullptr;
+	if (FRPCMap* BlockedQueues = BlockedRPCs.Find(Type))
+	{
+		RPCQueue = BlockedQueues->Find(EntityId);
+	}
+	if (RPCQueue == nullptr)
+	{
+		RPCQueue = &QueuedRPCs.FindOrAdd(Type).FindOrAdd(EntityId);
+	}
+
+	const FQueueLimits* Limits = QueueLimits.Find(Type);
+	if (Limits != nullptr && Limits->MaxDepth > 0 && uint32(RPCQueue->Num()) >= Limits->MaxDepth)
+	{
+		RPCQueue->Pop();
+		INC_DWORD_STAT(STAT_SpatialQueuedRPCsDropped);
+	}
+
+	RPCQueue->Push(MoveTemp(Params));
+	INC_DWORD_STAT(STAT_SpatialRPCsQueued);
+}
+
+void FRPCContainer::ExpireRPCs(FRPCQueue& RPCQueue, const FQueueLimits* Limits, double Now)
+{
+	if (Limits == nullptr || Limits->TimeToLive <= 0.0f)
+	{
+		return;
+	}
+
+	// RPCs are queued in order, so only the front of the queue can have expired.
+	while (RPCQueue.Num() > 0 && Now - RPCQueue.Peek().QueuedTime > Limits->TimeToLive)
+	{
+		RPCQueue.Pop();
+		INC_DWORD_STAT(STAT_SpatialQueuedRPCsExpired);
+	}
 }
 
-void FRPCContainer::ProcessRPCs(const FProcessRPCDelegate& FunctionToApply, FArrayOfParams& RPCList)
+EProcessRPCResult FRPCContainer::ProcessRPCs(const FProcessRPCDelegate& FunctionToApply, FRPCQueue& RPCQueue, const FQueueLimits* Limits, double Now)
 {
-	// TODO: UNR-1651 Find a way to drop queued RPCs
-	int NumProcessedParams = 0;
-	for (auto& Params : RPCList)
+	while (RPCQueue.Num() > 0)
 	{
-		if (ApplyFunction(FunctionToApply, *Params))
+		ExpireRPCs(RPCQueue, Limits, Now);
+		if (RPCQueue.Num() == 0)
 		{
-			NumProcessedParams++;
+			break;
 		}
-		else
+
+		const FPendingRPCParams& Params = RPCQueue.Peek();
+
+		const EProcessRPCResult Result = FunctionToApply.Execute(Params);
+		switch (Result)
 		{
+		case EProcessRPCResult::Processed:
+			RPCQueue.Pop();
+			break;
+		case EProcessRPCResult::Drop:
+			RPCQueue.Pop();
+			INC_DWORD_STAT(STAT_SpatialQueuedRPCsDropped);
 			break;
+		default:
+			return Result;
 		}
 	}
-	RPCList.RemoveAt(0, NumProcessedParams);
+
+	return EProcessRPCResult::Processed;
 }
 
 void FRPCContainer::ProcessRPCs(const FProcessRPCDelegate& FunctionToApply)
 {
+	const double Now = FPlatformTime::Seconds();
+
 	for (auto& RPCs : QueuedRPCs)
 	{
+		const FQueueLimits* Limits = QueueLimits.Find(RPCs.Key);
+
 		FRPCMap& MapOfQueues = RPCs.Value;
-		for(auto It = MapOfQueues.CreateIterator(); It; ++It)
+		for (auto It = MapOfQueues.CreateIterator(); It; ++It)
+		{
+			FRPCQueue& RPCQueue = It.Value();
+			if (ProcessRPCs(FunctionToApply, RPCQueue, Limits, Now) == EProcessRPCResult::TargetUnresolved)
+			{
+				BlockedRPCs.FindOrAdd(RPCs.Key).Add(It.Key(), MoveTemp(RPCQueue));
+				It.RemoveCurrent();
+			}
+			else if (RPCQueue.Num() == 0)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	// Blocked queues aren't retried, but their RPCs still expire.
+	for (auto& RPCs : BlockedRPCs)
+	{
+		const FQueueLimits* Limits = QueueLimits.Find(RPCs.Key);
+		if (Limits == nullptr || Limits->TimeToLive <= 0.0f)
+		{
+			continue;
+		}
+
+		for (auto It = RPCs.Value.CreateIterator(); It; ++It)
 		{
-			FArrayOfParams& RPCList = It.Value();
-			ProcessRPCs(FunctionToApply, RPCList);
-			if (RPCList.Num() == 0)
+			ExpireRPCs(It.Value(), Limits, Now);
+			if (It.Value().Num() == 0)
 			{
 				It.RemoveCurrent();
 			}
@@ -56,18 +170,46 @@ void FRPCContainer::ProcessRPCs(const FProcessRPCDelegate& FunctionToApply)
 
 bool FRPCContainer::ObjectHasRPCsQueuedOfType(const Worker_EntityId& EntityId, ESchemaComponentType Type) const
 {
-	if(const FRPCMap* MapOfQueues = QueuedRPCs.Find(Type))
+	for (const RPCContainerType* Container : { &QueuedRPCs, &BlockedRPCs })
 	{
-		if(const FArrayOfParams* RPCList = MapOfQueues->Find(EntityId))
+		if (const FRPCMap* MapOfQueues = Container->Find(Type))
 		{
-			return (RPCList->Num() > 0);
+			if (const FRPCQueue* RPCQueue = MapOfQueues->Find(EntityId))
+			{
+				if (RPCQueue->Num() > 0)
+				{
+					return true;
+				}
+			}
 		}
 	}
 
 	return false;
 }
 
-bool FRPCContainer::ApplyFunction(const FProcessRPCDelegate& FunctionToApply, const FPendingRPCParams& Params)
+void FRPCContainer::UnblockEntity(Worker_EntityId EntityId)
 {
-	return FunctionToApply.Execute(Params);
+	for (auto& RPCs : BlockedRPCs)
+	{
+		if (FRPCQueue* BlockedQueue = RPCs.Value.Find(EntityId))
+		{
+			QueuedRPCs.FindOrAdd(RPCs.Key).Add(EntityId, MoveTemp(*BlockedQueue));
+			RPCs.Value.Remove(EntityId);
+		}
+	}
+}
+
+void FRPCContainer::DropEntity(Worker_EntityId EntityId)
+{
+	for (RPCContainerType* Container : { &QueuedRPCs, &BlockedRPCs })
+	{
+		for (auto& RPCs : *Container)
+		{
+			if (const FRPCQueue* RPCQueue = RPCs.Value.Find(EntityId))
+			{
+				INC_DWORD_STAT_BY(STAT_SpatialQueuedRPCsDropped, RPCQueue->Num());
+				RPCs.Value.Remove(EntityId);
+			}
+		}
+	}
 }
@@ -0,0 +1,75 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/RelevancyGrid.h"
+
+FRelevancyGrid::FRelevancyGrid(float InCellSize)
+	: InvCellSize(1.f / FMath::Max(InCellSize, 1.f))
+	, CurrentUpdatePass(0)
+{
+}
+
+void FRelevancyGrid::BeginUpdate()
+{
+	CurrentUpdatePass++;
+}
+
+void FRelevancyGrid::Update(uint32 Id, const FVector& Location, int32 UpdateIndex)
+{
+	const FIntPoint Cell = GetCell(Location);
+
+	if (int32* ExistingEntryIndex = IdToEntry.Find(Id))
+	{
+		const int32 EntryIndex = *ExistingEntryIndex;
+		FEntry& Entry = Entries[EntryIndex];
+		if (Entry.Cell != Cell)
+		{
+			RemoveFromCell(Entry.Cell, EntryIndex);
+			Cells.FindOrAdd(Cell).Add(EntryIndex);
+			Entry.Cell = Cell;
+		}
+
+		Entry.Location = Location;
+		Entry.UpdateIndex = UpdateIndex;
+		Entry.UpdatePass = CurrentUpdatePass;
+		return;
+	}
+
+	int32 EntryIndex;
+	if (FreeEntries.Num() > 0)
+	{
+		EntryIndex = FreeEntries.Pop(/* bAllowShrinking */ false);
+	}
+	else
+	{
+		EntryIndex = Entries.AddUninitialized();
+	}
+
+	Entries[EntryIndex] = FEntry{ Location, Cell, UpdateIndex, CurrentUpdatePass };
+	IdToEntry.Add(Id, EntryIndex);
+	Cells.FindOrAdd(Cell).Add(EntryIndex);
+}
+
+void FRelevancyGrid::Remove(uint32 Id)
+{
+	int32 EntryIndex = INDEX_NONE;
+	if (!IdToEntry.RemoveAndCopyValue(Id, EntryIndex))
+	{
+		return;
+	}
+
+	RemoveFromCell(Entries[EntryIndex].Cell, EntryIndex);
+	Entries[EntryIndex].UpdatePass = 0;
+	FreeEntries.Add(EntryIndex);
+}
+
+void FRelevancyGrid::RemoveFromCell(const FIntPoint& Cell, int32 EntryIndex)
+{
+	if (TArray<int32>* CellEntries = Cells.Find(Cell))
+	{
+		CellEntries->RemoveSingleSwap(EntryIndex, /* bAllowShrinking */ false);
+		if (CellEntries->Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
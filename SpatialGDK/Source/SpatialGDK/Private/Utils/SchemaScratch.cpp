@@ -0,0 +1,77 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/SchemaScratch.h"
+
+#include "EngineClasses/SpatialNetDriver.h"
+#include "EngineClasses/SpatialPackageMapClient.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Schema Scratch Writes"), STAT_SpatialSchemaScratchWrites, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Schema Scratch Buffer Allocations"), STAT_SpatialSchemaScratchBufferAllocations, STATGROUP_SpatialNet);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Schema Objects Created"), STAT_SpatialSchemaObjectsCreated, STATGROUP_SpatialNet);
+
+namespace SpatialGDK
+{
+
+FSchemaScratch::FSchemaScratch(USpatialPackageMapClient* InPackageMap)
+	: PackageMap(InPackageMap)
+{
+	CreateWriter();
+}
+
+void FSchemaScratch::CreateWriter()
+{
+	Writer = MakeUnique<FSpatialNetBitWriter>(PackageMap, UnresolvedObjects);
+	EmptyMark = MakeUnique<FBitWriterMark>(*Writer);
+}
+
+FSpatialNetBitWriter& FSchemaScratch::BeginWrite()
+{
+	// Properties are copied into their schema object before the next one is serialized, so writes never nest.
+	check(!bWriting);
+	bWriting = true;
+
+	// Only zeroes the bytes written last time, the buffer itself is kept.
+	EmptyMark->Pop(*Writer);
+	BufferBytesAtBeginWrite = Writer->GetBuffer()->Num();
+	Writes++;
+
+	return *Writer;
+}
+
+void FSchemaScratch::EndWrite(TSet<TWeakObjectPtr<const UObject>>& OutUnresolvedObjects)
+{
+	check(bWriting);
+	bWriting = false;
+
+	// The writer grows its buffer (reallocating it) whenever a property doesn't fit.
+	if (Writer->GetBuffer()->Num() > BufferBytesAtBeginWrite)
+	{
+		BufferAllocations++;
+	}
+
+	if (UnresolvedObjects.Num() > 0)
+	{
+		OutUnresolvedObjects.Append(UnresolvedObjects);
+		UnresolvedObjects.Reset();
+	}
+}
+
+void FSchemaScratch::EndFrame()
+{
+	check(!bWriting);
+
+	if (Writer->GetBuffer()->Num() > MaxRetainedBytes)
+	{
+		CreateWriter();
+	}
+
+	SET_DWORD_STAT(STAT_SpatialSchemaScratchWrites, Writes);
+	SET_DWORD_STAT(STAT_SpatialSchemaScratchBufferAllocations, BufferAllocations);
+	SET_DWORD_STAT(STAT_SpatialSchemaObjectsCreated, SchemaObjectsCreated);
+
+	Writes = 0;
+	BufferAllocations = 0;
+	SchemaObjectsCreated = 0;
+}
+
+} // namespace SpatialGDK
@@ -9,18 +9,18 @@ namespace SpatialGDK
 
 void GetFullPathFromUnrealObjectReference(const FUnrealObjectRef& ObjectRef, FString& OutPath)
 {
-	if (!ObjectRef.Path.IsSet())
+	if (!ObjectRef.HasPath())
 	{
 		return;
 	}
 
-	if (ObjectRef.Outer.IsSet())
+	if (ObjectRef.HasOuter())
 	{
-		GetFullPathFromUnrealObjectReference(*ObjectRef.Outer, OutPath);
+		GetFullPathFromUnrealObjectReference(ObjectRef.GetOuter(), OutPath);
 		OutPath.Append(TEXT("."));
 	}
 
-	OutPath.Append(*ObjectRef.Path);
+	OutPath.Append(ObjectRef.GetPath());
 }
 
 } // namespace SpatialGDK
@@ -0,0 +1,739 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+// Microbenchmarks for hot paths in the GDK. These run synthetic workloads in-process and log their results,
+// so they can be run from the console of any build, e.g. "Spatial.Benchmark.OutgoingMessageQueue 1000000".
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+#include "Interop/Connection/OutgoingMessageQueue.h"
+#include "Interop/SpatialStaticComponentView.h"
+#include "Schema/RPCPayload.h"
+#include "Schema/StandardLibrary.h"
+#include "Schema/UnrealObjectRef.h"
+#include "SpatialConstants.h"
+#include "Utils/EntityDeleteBatcher.h"
+#include "Utils/RelevancyGrid.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSpatialBenchmarks, Log, All);
+
+using namespace SpatialGDK;
+
+namespace
+{
+
+int32 GetBenchmarkCount(const TArray<FString>& Args, int32 DefaultCount, int32 ArgIndex = 0)
+{
+	return Args.Num() > ArgIndex ? FMath::Max(1, FCString::Atoi(*Args[ArgIndex])) : DefaultCount;
+}
+
+// Queues and drains component updates in frame-sized batches, comparing the lock-free ring against
+// the previous TQueue<TUniquePtr<...>> approach which allocated every message.
+void BenchmarkOutgoingMessageQueue(const TArray<FString>& Args)
+{
+	const int32 BatchSize = 1000;
+	const int32 NumBatches = FMath::DivideAndRoundUp(GetBenchmarkCount(Args, 1000000), BatchSize);
+	const int32 NumMessages = NumBatches * BatchSize;
+
+	Worker_ComponentUpdate Update = {};
+
+	double AllocatingQueueSeconds = 0.0;
+	{
+		TQueue<TUniquePtr<FComponentUpdate>, EQueueMode::Spsc> Queue;
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Batch = 0; Batch < NumBatches; Batch++)
+		{
+			for (int32 i = 0; i < BatchSize; i++)
+			{
+				Queue.Enqueue(MakeUnique<FComponentUpdate>(i, Update));
+			}
+
+			TUniquePtr<FComponentUpdate> Message;
+			while (Queue.Dequeue(Message))
+			{
+				Message.Reset();
+			}
+		}
+		AllocatingQueueSeconds = FPlatformTime::Seconds() - StartTime;
+	}
+
+	double RingQueueSeconds = 0.0;
+	{
+		FOutgoingMessageQueue Queue(BatchSize);
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Batch = 0; Batch < NumBatches; Batch++)
+		{
+			for (int32 i = 0; i < BatchSize; i++)
+			{
+				Queue.Enqueue<FComponentUpdate>(i, Update);
+			}
+
+			while (Queue.Peek() != nullptr)
+			{
+				Queue.Pop();
+			}
+		}
+		RingQueueSeconds = FPlatformTime::Seconds() - StartTime;
+	}
+
+	UE_LOG(LogSpatialBenchmarks, Log, TEXT("OutgoingMessageQueue: %d messages. TQueue<TUniquePtr>: %.3f ms (%.1f ns/msg). FOutgoingMessageQueue: %.3f ms (%.1f ns/msg)."),
+		NumMessages,
+		AllocatingQueueSeconds * 1000.0, AllocatingQueueSeconds * 1e9 / NumMessages,
+		RingQueueSeconds * 1000.0, RingQueueSeconds * 1e9 / NumMessages);
+}
+
+FAutoConsoleCommand BenchmarkOutgoingMessageQueueCommand(
+	TEXT("Spatial.Benchmark.OutgoingMessageQueue"),
+	TEXT("Compares queueing outgoing component updates through FOutgoingMessageQueue against an allocating TQueue. Optional argument: number of messages."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkOutgoingMessageQueue));
+
+// Mirrors the nested map layout USpatialStaticComponentView used before it moved to per-component columns.
+struct FNestedMapComponentView
+{
+	TMap<Worker_EntityId_Key, TMap<Worker_ComponentId, Worker_Authority>> EntityComponentAuthorityMap;
+	TMap<Worker_EntityId_Key, TMap<Worker_ComponentId, TUniquePtr<Component>>> EntityComponentMap;
+
+	void OnAddComponent(const Worker_AddComponentOp& Op)
+	{
+		TUniquePtr<Component> Data;
+		if (Op.data.component_id == SpatialConstants::POSITION_COMPONENT_ID)
+		{
+			Data = MakeUnique<Position>(Op.data);
+		}
+		EntityComponentMap.FindOrAdd(Op.entity_id).FindOrAdd(Op.data.component_id) = MoveTemp(Data);
+	}
+
+	void OnAuthorityChange(const Worker_AuthorityChangeOp& Op)
+	{
+		EntityComponentAuthorityMap.FindOrAdd(Op.entity_id).FindOrAdd(Op.component_id) = (Worker_Authority)Op.authority;
+	}
+
+	bool HasAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId)
+	{
+		if (TMap<Worker_ComponentId, Worker_Authority>* ComponentAuthorityMap = EntityComponentAuthorityMap.Find(EntityId))
+		{
+			if (Worker_Authority* Authority = ComponentAuthorityMap->Find(ComponentId))
+			{
+				return *Authority == WORKER_AUTHORITY_AUTHORITATIVE;
+			}
+		}
+		return false;
+	}
+
+	void OnComponentUpdate(const Worker_ComponentUpdateOp& Op)
+	{
+		if (TMap<Worker_ComponentId, TUniquePtr<Component>>* ComponentMap = EntityComponentMap.Find(Op.entity_id))
+		{
+			if (TUniquePtr<Component>* Data = ComponentMap->Find(Op.update.component_id))
+			{
+				(*Data)->ApplyComponentUpdate(Op.update);
+			}
+		}
+	}
+
+	void OnRemoveEntity(Worker_EntityId EntityId)
+	{
+		EntityComponentMap.Remove(EntityId);
+		EntityComponentAuthorityMap.Remove(EntityId);
+	}
+};
+
+struct FComponentViewTimings
+{
+	double AddSeconds = 0.0;
+	double LookupSeconds = 0.0;
+	double UpdateSeconds = 0.0;
+	double RemoveSeconds = 0.0;
+};
+
+template <typename ViewType>
+FComponentViewTimings RunComponentViewBenchmark(ViewType& View, int32 NumEntities, const TArray<Worker_ComponentData>& Components, const Worker_ComponentUpdate& PositionUpdate)
+{
+	FComponentViewTimings Timings;
+
+	double StartTime = FPlatformTime::Seconds();
+	for (Worker_EntityId EntityId = 1; EntityId <= NumEntities; EntityId++)
+	{
+		for (const Worker_ComponentData& Data : Components)
+		{
+			View.OnAddComponent(Worker_AddComponentOp{ EntityId, Data });
+			View.OnAuthorityChange(Worker_AuthorityChangeOp{ EntityId, Data.component_id, static_cast<uint8_t>(EntityId % 2 == 0 ? WORKER_AUTHORITY_AUTHORITATIVE : WORKER_AUTHORITY_NOT_AUTHORITATIVE) });
+		}
+	}
+	Timings.AddSeconds = FPlatformTime::Seconds() - StartTime;
+
+	int32 NumAuthoritative = 0;
+	StartTime = FPlatformTime::Seconds();
+	for (Worker_EntityId EntityId = 1; EntityId <= NumEntities; EntityId++)
+	{
+		for (const Worker_ComponentData& Data : Components)
+		{
+			NumAuthoritative += View.HasAuthority(EntityId, Data.component_id) ? 1 : 0;
+		}
+	}
+	Timings.LookupSeconds = FPlatformTime::Seconds() - StartTime;
+	check(NumAuthoritative == (NumEntities / 2) * Components.Num());
+
+	StartTime = FPlatformTime::Seconds();
+	for (Worker_EntityId EntityId = 1; EntityId <= NumEntities; EntityId++)
+	{
+		View.OnComponentUpdate(Worker_ComponentUpdateOp{ EntityId, PositionUpdate });
+	}
+	Timings.UpdateSeconds = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	for (Worker_EntityId EntityId = 1; EntityId <= NumEntities; EntityId++)
+	{
+		View.OnRemoveEntity(EntityId);
+	}
+	Timings.RemoveSeconds = FPlatformTime::Seconds() - StartTime;
+
+	return Timings;
+}
+
+// Adds, looks up authority for, updates and removes NumEntities entities with 10 components each (Position plus
+// nine generated components), comparing USpatialStaticComponentView against the previous nested map layout.
+void BenchmarkStaticComponentView(const TArray<FString>& Args)
+{
+	const int32 NumEntities = GetBenchmarkCount(Args, 100000);
+	const int32 NumGeneratedComponents = 9;
+
+	TArray<Worker_ComponentData> Components;
+	Components.Add(Position(Origin).CreatePositionData());
+	for (int32 i = 0; i < NumGeneratedComponents; i++)
+	{
+		Worker_ComponentData Data = {};
+		Data.component_id = SpatialConstants::STARTING_GENERATED_COMPONENT_ID + i;
+		Components.Add(Data);
+	}
+
+	Worker_ComponentUpdate PositionUpdate = Position::CreatePositionUpdate(Coordinates{ 1.0, 2.0, 3.0 });
+
+	FNestedMapComponentView NestedMapView;
+	const FComponentViewTimings NestedMapTimings = RunComponentViewBenchmark(NestedMapView, NumEntities, Components, PositionUpdate);
+
+	USpatialStaticComponentView* StaticComponentView = NewObject<USpatialStaticComponentView>();
+	const FComponentViewTimings ColumnTimings = RunComponentViewBenchmark(*StaticComponentView, NumEntities, Components, PositionUpdate);
+	StaticComponentView->MarkPendingKill();
+
+	Schema_DestroyComponentUpdate(PositionUpdate.schema_type);
+	Schema_DestroyComponentData(Components[0].schema_type);
+
+	UE_LOG(LogSpatialBenchmarks, Log, TEXT("StaticComponentView: %d entities x %d components."), NumEntities, Components.Num());
+	UE_LOG(LogSpatialBenchmarks, Log, TEXT("  Nested maps: add %.3f ms, authority lookup %.3f ms, update %.3f ms, remove %.3f ms"),
+		NestedMapTimings.AddSeconds * 1000.0, NestedMapTimings.LookupSeconds * 1000.0, NestedMapTimings.UpdateSeconds * 1000.0, NestedMapTimings.RemoveSeconds * 1000.0);
+	UE_LOG(LogSpatialBenchmarks, Log, TEXT("  Columns:     add %.3f ms, authority lookup %.3f ms, update %.3f ms, remove %.3f ms"),
+		ColumnTimings.AddSeconds * 1000.0, ColumnTimings.LookupSeconds * 1000.0, ColumnTimings.UpdateSeconds * 1000.0, ColumnTimings.RemoveSeconds * 1000.0);
+}
+
+FAutoConsoleCommand BenchmarkStaticComponentViewCommand(
+	TEXT("Spatial.Benchmark.StaticComponentView"),
+	TEXT("Compares add, authority lookup, update and removal throughput of USpatialStaticComponentView against nested maps. Optional argument: number of entities."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkStaticComponentView));
+
+// Stand-in for AActor::GetNetPriority: closer actors are weighted higher.
+float GetSyntheticNetPriority(const FVector& ActorLocation, const FVector& ViewLocation)
+{
+	const float DistSquared = FVector::DistSquared(ActorLocation, ViewLocation);
+	return DistSquared < FMath::Square(700.f) ? 2.f : (DistSquared < FMath::Square(3000.f) ? 1.5f : 1.f);
+}
+
+// Replays the prioritization step of USpatialNetDriver::ServerReplicateActors over a synthetic world: half the actors
+// are spread uniformly over the map and half are clustered around the viewers, and every actor moves a little each
+// frame. Compares weighing every actor against every viewer with querying the relevancy grid around each viewer.
+void BenchmarkRelevancyGrid(const TArray<FString>& Args)
+{
+	const int32 NumActors = GetBenchmarkCount(Args, 10000, 0);
+	const int32 NumViewers = GetBenchmarkCount(Args, 100, 1);
+	const int32 NumFrames = 30;
+	const float WorldSize = 400000.f; // 4km
+	const float CullDistanceSquared = 225000000.f; // Default Actor NetCullDistanceSquared (150m)
+	const float CellSize = 10000.f;
+
+	FRandomStream Random(0x5EED);
+
+	TArray<FVector> ViewLocations;
+	for (int32 i = 0; i < NumViewers; i++)
+	{
+		ViewLocations.Add(FVector(Random.FRandRange(0.f, WorldSize), Random.FRandRange(0.f, WorldSize), 0.f));
+	}
+
+	TArray<FVector> ActorLocations;
+	TArray<FVector> ActorVelocities;
+	for (int32 i = 0; i < NumActors; i++)
+	{
+		if (i % 2 == 0)
+		{
+			ActorLocations.Add(FVector(Random.FRandRange(0.f, WorldSize), Random.FRandRange(0.f, WorldSize), Random.FRandRange(0.f, 1000.f)));
+		}
+		else
+		{
+			ActorLocations.Add(ViewLocations[Random.RandHelper(NumViewers)] + Random.GetUnitVector() * Random.FRandRange(0.f, 20000.f));
+		}
+		ActorVelocities.Add(Random.GetUnitVector() * 100.f);
+	}
+
+	TArray<int32> Priorities;
+	Priorities.SetNumZeroed(NumActors);
+
+	double BruteForceSeconds = 0.0;
+	int64 BruteForceChecksum = 0;
+	{
+		TArray<FVector> Locations = ActorLocations;
+		for (int32 Frame = 0; Frame < NumFrames; Frame++)
+		{
+			for (int32 i = 0; i < NumActors; i++)
+			{
+				Locations[i] += ActorVelocities[i];
+			}
+
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 i = 0; i < NumActors; i++)
+			{
+				int32 Priority = 0;
+				for (const FVector& ViewLocation : ViewLocations)
+				{
+					if (FVector::DistSquared(Locations[i], ViewLocation) <= CullDistanceSquared)
+					{
+						Priority = FMath::Max<int32>(Priority, FMath::RoundToInt(65536.0f * GetSyntheticNetPriority(Locations[i], ViewLocation)));
+					}
+				}
+				Priorities[i] = Priority;
+			}
+			BruteForceSeconds += FPlatformTime::Seconds() - StartTime;
+		}
+
+		for (int32 Priority : Priorities)
+		{
+			BruteForceChecksum += Priority;
+		}
+	}
+
+	double GridSeconds = 0.0;
+	int64 GridChecksum = 0;
+	{
+		FRelevancyGrid Grid(CellSize);
+		TArray<FVector> Locations = ActorLocations;
+		const float QueryRadius = FMath::Sqrt(CullDistanceSquared);
+		for (int32 Frame = 0; Frame < NumFrames; Frame++)
+		{
+			for (int32 i = 0; i < NumActors; i++)
+			{
+				Locations[i] += ActorVelocities[i];
+			}
+
+			const double StartTime = FPlatformTime::Seconds();
+			Grid.BeginUpdate();
+			for (int32 i = 0; i < NumActors; i++)
+			{
+				Grid.Update(i, Locations[i], i);
+				Priorities[i] = 0;
+			}
+
+			for (const FVector& ViewLocation : ViewLocations)
+			{
+				Grid.ForEachInRadius(ViewLocation, QueryRadius, [&](int32 Index, const FVector& Location)
+				{
+					if (FVector::DistSquared(Location, ViewLocation) <= CullDistanceSquared)
+					{
+						Priorities[Index] = FMath::Max<int32>(Priorities[Index], FMath::RoundToInt(65536.0f * GetSyntheticNetPriority(Location, ViewLocation)));
+					}
+				});
+			}
+			GridSeconds += FPlatformTime::Seconds() - StartTime;
+		}
+
+		for (int32 Priority : Priorities)
+		{
+			GridChecksum += Priority;
+		}
+	}
+
+	// Both approaches must agree on the final priorities.
+	check(BruteForceChecksum == GridChecksum);
+
+	UE_LOG(LogSpatialBenchmarks, Log, TEXT("RelevancyGrid: %d actors, %d viewers, %d frames. All viewers: %.3f ms/frame. Relevancy grid: %.3f ms/frame."),
+		NumActors, NumViewers, NumFrames,
+		BruteForceSeconds * 1000.0 / NumFrames,
+		GridSeconds * 1000.0 / NumFrames);
+}
+
+FAutoConsoleCommand BenchmarkRelevancyGridCommand(
+	TEXT("Spatial.Benchmark.RelevancyGrid"),
+	TEXT("Compares prioritizing actors against every viewer with prioritizing them through the relevancy grid. Optional arguments: number of actors, number of viewers."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkRelevancyGrid));
+
+struct FRPCPayloadCopyStats
+{
+	double Seconds = 0.0;
+	int64 BytesCopied = 0;
+};
+
+// A step copied the payload if the bytes it hands on are in different memory than the bytes it was given.
+void CountPayloadCopy(const uint8* From, const uint8* To, int32 NumBytes, FRPCPayloadCopyStats& Stats)
+{
+	if (From != To)
+	{
+		Stats.BytesCopied += NumBytes;
+	}
+}
+
+// Sends NumRPCs packed RPCs with PayloadSize byte payloads through one update and reads them back, following the
+// payload through every step of the sender and receiver. The previous path copied the writer's bytes into an
+// RPCPayload, into an FPendingRPC, into the schema object, then on receipt into an RPCPayload, into a copy of it and
+// into the reader. The current path moves the writer's buffer into the RPCPayload, writes it straight into the schema
+// object and reads it in place.
+FRPCPayloadCopyStats RunRPCPayloadBenchmark(int32 NumRPCs, int32 PayloadSize, bool bZeroCopy)
+{
+	FRPCPayloadCopyStats Stats;
+
+	TArray<uint8> Parameters;
+	for (int32 i = 0; i < PayloadSize; i++)
+	{
+		Parameters.Add(uint8(i));
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	Schema_ComponentUpdate* Update = Schema_CreateComponentUpdate(SpatialConstants::SERVER_RPC_ENDPOINT_COMPONENT_ID);
+	Schema_Object* EventsObject = Schema_GetComponentUpdateEvents(Update);
+
+	for (int32 i = 0; i < NumRPCs; i++)
+	{
+		FBitWriter Writer(0, /* AllowResize */ true);
+		Writer.Serialize(Parameters.GetData(), PayloadSize);
+		const uint8* WriterData = Writer.GetData();
+
+		Schema_Object* EventData = Schema_AddObject(EventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_PACKED_EVENT_ID);
+		if (bZeroCopy)
+		{
+			RPCPayload Payload(0, i, MoveTemp(Writer));
+			CountPayloadCopy(WriterData, Payload.PayloadData.GetData(), PayloadSize, Stats);
+
+			RPCPayload::WriteToSchemaObject(EventData, Payload.Offset, Payload.Index, Payload.PayloadData.GetData(), Payload.PayloadData.Num());
+			CountPayloadCopy(Payload.PayloadData.GetData(), Schema_GetBytes(EventData, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_PAYLOAD_ID), PayloadSize, Stats);
+		}
+		else
+		{
+			RPCPayload Payload(0, i, TArray<uint8>(Writer.GetData(), Writer.GetNumBytes()));
+			CountPayloadCopy(WriterData, Payload.PayloadData.GetData(), PayloadSize, Stats);
+
+			TArray<uint8> PendingData(Payload.PayloadData.GetData(), Payload.PayloadData.Num());
+			CountPayloadCopy(Payload.PayloadData.GetData(), PendingData.GetData(), PayloadSize, Stats);
+
+			RPCPayload::WriteToSchemaObject(EventData, Payload.Offset, Payload.Index, PendingData.GetData(), PendingData.Num());
+			CountPayloadCopy(PendingData.GetData(), Schema_GetBytes(EventData, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_PAYLOAD_ID), PayloadSize, Stats);
+		}
+	}
+
+	int64 Checksum = 0;
+	const uint32 EventCount = Schema_GetObjectCount(EventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_PACKED_EVENT_ID);
+	for (uint32 i = 0; i < EventCount; i++)
+	{
+		Schema_Object* EventData = Schema_IndexObject(EventsObject, SpatialConstants::UNREAL_RPC_ENDPOINT_PACKED_EVENT_ID, i);
+		const uint8* SchemaData = Schema_GetBytes(EventData, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_PAYLOAD_ID);
+
+		TArray<uint8> Received;
+		Received.SetNumUninitialized(PayloadSize);
+
+		if (bZeroCopy)
+		{
+			RPCPayloadView Payload(EventData);
+			CountPayloadCopy(SchemaData, Payload.Data, PayloadSize, Stats);
+
+			FBitReader Reader(const_cast<uint8*>(Payload.Data), Payload.CountDataBits());
+			CountPayloadCopy(Payload.Data, Reader.GetData(), PayloadSize, Stats);
+			Reader.Serialize(Received.GetData(), PayloadSize);
+		}
+		else
+		{
+			RPCPayload Payload(EventData);
+			CountPayloadCopy(SchemaData, Payload.PayloadData.GetData(), PayloadSize, Stats);
+
+			RPCPayload PayloadCopy = Payload;
+			CountPayloadCopy(Payload.PayloadData.GetData(), PayloadCopy.PayloadData.GetData(), PayloadSize, Stats);
+
+			FBitReader Reader(PayloadCopy.PayloadData.GetData(), PayloadCopy.CountDataBits());
+			CountPayloadCopy(PayloadCopy.PayloadData.GetData(), Reader.GetData(), PayloadSize, Stats);
+			Reader.Serialize(Received.GetData(), PayloadSize);
+		}
+
+		Checksum += Received.Last();
+	}
+
+	Schema_DestroyComponentUpdate(Update);
+
+	Stats.Seconds = FPlatformTime::Seconds() - StartTime;
+
+	check(Checksum == int64(NumRPCs) * uint8(PayloadSize - 1));
+
+	return Stats;
+}
+
+void BenchmarkRPCPayload(const TArray<FString>& Args)
+{
+	const int32 NumRPCs = GetBenchmarkCount(Args, 10000, 0);
+	const int32 PayloadSize = GetBenchmarkCount(Args, 256, 1);
+
+	const FRPCPayloadCopyStats CopyingStats = RunRPCPayloadBenchmark(NumRPCs, PayloadSize, /* bZeroCopy */ false);
+	const FRPCPayloadCopyStats ZeroCopyStats = RunRPCPayloadBenchmark(NumRPCs, PayloadSize, /* bZeroCopy */ true);
+
+	UE_LOG(LogSpatialBenchmarks, Log, TEXT("RPCPayload: %d packed RPCs of %d bytes. Previous path: %.3f ms, %lld bytes copied per RPC. Current path: %.3f ms, %lld bytes copied per RPC."),
+		NumRPCs, PayloadSize,
+		CopyingStats.Seconds * 1000.0, CopyingStats.BytesCopied / NumRPCs,
+		ZeroCopyStats.Seconds * 1000.0, ZeroCopyStats.BytesCopied / NumRPCs);
+}
+
+FAutoConsoleCommand BenchmarkRPCPayloadCommand(
+	TEXT("Spatial.Benchmark.RPCPayload"),
+	TEXT("Compares the bytes copied and time taken to send and receive packed RPC payloads before and after moving them out of the writer and reading them in place. Optional arguments: number of RPCs, payload size in bytes."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkRPCPayload));
+
+// Mirrors the layout FUnrealObjectRef had before its paths and outers were interned.
+struct FLegacyObjectRef
+{
+	FLegacyObjectRef() = default;
+
+	FLegacyObjectRef(Worker_EntityId InEntity, uint32 InOffset)
+		: Entity(InEntity)
+		, Offset(InOffset)
+	{}
+
+	FLegacyObjectRef(Worker_EntityId InEntity, uint32 InOffset, const FString& InPath, const FLegacyObjectRef& InOuter)
+		: Entity(InEntity)
+		, Offset(InOffset)
+		, Path(InPath)
+		, Outer(InOuter)
+	{}
+
+	bool operator==(const FLegacyObjectRef& Other) const
+	{
+		return Entity == Other.Entity &&
+			Offset == Other.Offset &&
+			((!Path && !Other.Path) || (Path && Other.Path && Path->Equals(*Other.Path))) &&
+			((!Outer && !Other.Outer) || (Outer && Other.Outer && *Outer == *Other.Outer));
+	}
+
+	Worker_EntityId Entity = 0;
+	uint32 Offset = 0;
+	TSchemaOption<FString> Path;
+	TSchemaOption<FLegacyObjectRef> Outer;
+};
+
+uint32 GetTypeHash(const FLegacyObjectRef& ObjectRef)
+{
+	uint32 Result = 1327u;
+	Result = (Result * 977u) + ::GetTypeHash(static_cast<int64>(ObjectRef.Entity));
+	Result = (Result * 977u) + ::GetTypeHash(ObjectRef.Offset);
+	Result = (Result * 977u) + ::GetTypeHash(ObjectRef.Path);
+	Result = (Result * 977u) + ::GetTypeHash(ObjectRef.Outer);
+	return Result;
+}
+
+FLegacyObjectRef ToLegacyObjectRef(const FUnrealObjectRef& ObjectRef)
+{
+	FLegacyObjectRef LegacyRef(ObjectRef.Entity, ObjectRef.Offset);
+	if (ObjectRef.HasPath())
+	{
+		LegacyRef.Path = ObjectRef.GetPath();
+	}
+	if (ObjectRef.HasOuter())
+	{
+		LegacyRef.Outer = ToLegacyObjectRef(ObjectRef.GetOuter());
+	}
+	return LegacyRef;
+}
+
+// Builds NumRefs refs, one in StablyNamedFraction of them stably named, the rest entity refs to actors and their subobjects.
+// The interning tables live as long as the process, so stably named refs are copies of the outers this process has already
+// interned, which are refs the package map really built, instead of adding made-up paths. Returns the number of stably named refs.
+int32 MakeObjectRefMix(int32 NumRefs, float StablyNamedFraction, const TArray<FUnrealObjectRef>& InternedOuters, TArray<FUnrealObjectRef>& OutRefs)
+{
+	FRandomStream Random(NumRefs);
+
+	int32 NumStablyNamed = 0;
+
+	OutRefs.Reserve(NumRefs);
+	for (int32 i = 0; i < NumRefs; i++)
+	{
+		FUnrealObjectRef Ref;
+		if (InternedOuters.Num() > 0 && Random.FRand() < StablyNamedFraction)
+		{
+			Ref = InternedOuters[i % InternedOuters.Num()];
+			NumStablyNamed++;
+		}
+		else
+		{
+			Ref.Entity = i + 1;
+			Ref.Offset = Random.RandRange(0, 8);
+		}
+		OutRefs.Add(Ref);
+	}
+
+	return NumStablyNamed;
+}
+
+template <typename RefType>
+double RunObjectRefMapBenchmark(const TArray<RefType>& Refs, int32 NumLookups)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	TMap<RefType, int32> Map;
+	for (int32 i = 0; i < Refs.Num(); i++)
+	{
+		Map.Add(Refs[i], i);
+	}
+
+	int64 Checksum = 0;
+	for (int32 i = 0; i < NumLookups; i++)
+	{
+		// Lookups go through a copy, as callers usually build the ref they look up.
+		const RefType Ref = Refs[(i * 7919) % Refs.Num()];
+		Checksum += *Map.Find(Ref);
+	}
+
+	const double Seconds = FPlatformTime::Seconds() - StartTime;
+	check(Checksum >= 0);
+	return Seconds;
+}
+
+void BenchmarkObjectRefMap(const TArray<FString>& Args)
+{
+	const int32 NumRefs = GetBenchmarkCount(Args, 100000, 0);
+	const int32 NumLookups = GetBenchmarkCount(Args, 1000000, 1);
+	const float StablyNamedFraction = 0.25f;
+
+	const TArray<FUnrealObjectRef> InternedOuters = FUnrealObjectRef::GetInternedOuters();
+
+	TArray<FUnrealObjectRef> InternedRefs;
+	const int32 NumStablyNamed = MakeObjectRefMix(NumRefs, StablyNamedFraction, InternedOuters, InternedRefs);
+
+	TArray<FLegacyObjectRef> LegacyRefs;
+	LegacyRefs.Reserve(NumRefs);
+	for (const FUnrealObjectRef& Ref : InternedRefs)
+	{
+		LegacyRefs.Add(ToLegacyObjectRef(Ref));
+	}
+
+	const double LegacySeconds = RunObjectRefMapBenchmark(LegacyRefs, NumLookups);
+	const double InternedSeconds = RunObjectRefMapBenchmark(InternedRefs, NumLookups);
+
+	UE_LOG(LogSpatialBenchmarks, Log, TEXT("ObjectRefMap: %d refs (%d stably named, from %d interned outers), %d lookups. String paths: %.3f ms (%d bytes per ref). Interned paths: %.3f ms (%d bytes per ref)."),
+		NumRefs, NumStablyNamed, InternedOuters.Num(), NumLookups,
+		LegacySeconds * 1000.0, int32(sizeof(FLegacyObjectRef)),
+		InternedSeconds * 1000.0, int32(sizeof(FUnrealObjectRef)));
+}
+
+FAutoConsoleCommand BenchmarkObjectRefMapCommand(
+	TEXT("Spatial.Benchmark.ObjectRefMap"),
+	TEXT("Compares inserting object refs into a TMap and looking them up with string paths against interned paths. Stably named refs are copies of the outers already interned by this process. Optional arguments: number of refs, number of lookups."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkObjectRefMap));
+
+// Stands in for the worker connection and the Runtime when deleting entities. Requests are queued in the order they are sent,
+// and a fixed number of them are answered per tick.
+struct FStandInDeleteConnection
+{
+	TArray<Worker_EntityId> Queued;
+	int32 NumAnswered = 0;
+	int32 PeakQueued = 0;
+
+	void SendDeleteEntityRequest(Worker_EntityId EntityId)
+	{
+		Queued.Add(EntityId);
+		PeakQueued = FMath::Max(PeakQueued, Queued.Num() - NumAnswered);
+	}
+
+	template <typename FOnResponse>
+	void Tick(int32 ResponsesPerTick, FOnResponse&& OnResponse)
+	{
+		const int32 NumToAnswer = FMath::Min(ResponsesPerTick, Queued.Num() - NumAnswered);
+		for (int32 i = 0; i < NumToAnswer; i++)
+		{
+			OnResponse(Queued[NumAnswered++]);
+		}
+	}
+};
+
+// Wipes a world of synthetic entities through a stand-in connection, comparing sending every delete request at once against
+// FEntityDeleteBatcher, and the size of a world query result with Position data against one with entity ids only.
+void BenchmarkWorldWipe(const TArray<FString>& Args)
+{
+	const int32 NumEntities = GetBenchmarkCount(Args, 100000);
+	const int32 MaxInFlight = GetBenchmarkCount(Args, 1000, 1);
+	const int32 ResponsesPerTick = 2000;
+
+	TArray<Worker_EntityId> EntityIds;
+	EntityIds.Reserve(NumEntities);
+	for (int32 i = 0; i < NumEntities; i++)
+	{
+		EntityIds.Add(SpatialConstants::FIRST_AVAILABLE_ENTITY_ID + i);
+	}
+
+	uint64 PositionResultBytes = 0;
+	for (int32 i = 0; i < NumEntities; i++)
+	{
+		Worker_ComponentData Data = Position(Coordinates{ static_cast<double>(i), 0.0, 0.0 }).CreatePositionData();
+		PositionResultBytes += sizeof(Worker_EntityId) + Schema_GetWriteBufferLength(Schema_GetComponentDataFields(Data.schema_type));
+		Schema_DestroyComponentData(Data.schema_type);
+	}
+	const uint64 IdOnlyResultBytes = static_cast<uint64>(NumEntities) * sizeof(Worker_EntityId);
+
+	int32 BurstTicks = 0;
+	int32 BurstPeakQueued = 0;
+	double BurstSeconds = 0.0;
+	{
+		FStandInDeleteConnection Connection;
+		const double StartTime = FPlatformTime::Seconds();
+		for (Worker_EntityId EntityId : EntityIds)
+		{
+			Connection.SendDeleteEntityRequest(EntityId);
+		}
+
+		int32 NumResponses = 0;
+		while (NumResponses < NumEntities)
+		{
+			Connection.Tick(ResponsesPerTick, [&NumResponses](Worker_EntityId) { NumResponses++; });
+			BurstTicks++;
+		}
+		BurstSeconds = FPlatformTime::Seconds() - StartTime;
+		BurstPeakQueued = Connection.PeakQueued;
+	}
+
+	int32 BatchedTicks = 0;
+	int32 BatchedPeakQueued = 0;
+	double BatchedSeconds = 0.0;
+	{
+		FStandInDeleteConnection Connection;
+		const double StartTime = FPlatformTime::Seconds();
+		FEntityDeleteBatcher Batcher(CopyTemp(EntityIds), MaxInFlight);
+		auto SendDelete = [&Connection](Worker_EntityId EntityId) { Connection.SendDeleteEntityRequest(EntityId); };
+
+		Batcher.SendRequests(SendDelete);
+		while (!Batcher.IsDone())
+		{
+			Connection.Tick(ResponsesPerTick, [&Batcher, &SendDelete](Worker_EntityId)
+			{
+				Batcher.OnDeleteResponse(true);
+				Batcher.SendRequests(SendDelete);
+			});
+			BatchedTicks++;
+		}
+		BatchedSeconds = FPlatformTime::Seconds() - StartTime;
+		BatchedPeakQueued = Connection.PeakQueued;
+	}
+
+	UE_LOG(LogSpatialBenchmarks, Log, TEXT("WorldWipe: %d entities, %d responses per tick. Query result with Position: %llu bytes, ids only: %llu bytes. ")
+		TEXT("All at once: %d ticks, peak %d requests queued, %.3f ms. Batched (%d in flight): %d ticks, peak %d requests queued, %.3f ms."),
+		NumEntities, ResponsesPerTick, PositionResultBytes, IdOnlyResultBytes,
+		BurstTicks, BurstPeakQueued, BurstSeconds * 1000.0,
+		MaxInFlight, BatchedTicks, BatchedPeakQueued, BatchedSeconds * 1000.0);
+}
+
+FAutoConsoleCommand BenchmarkWorldWipeCommand(
+	TEXT("Spatial.Benchmark.WorldWipe"),
+	TEXT("Compares wiping a world of synthetic entities through a stand-in connection with and without batching delete requests. Optional arguments: number of entities, deletes in flight."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkWorldWipe));
+
+} // anonymous namespace
@@ -15,6 +15,9 @@
 
 DEFINE_LOG_CATEGORY(LogSpatialMetrics);
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Component updates queued"), STAT_SpatialComponentUpdatesQueued, STATGROUP_SpatialNet);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Component updates sent"), STAT_SpatialComponentUpdatesSent, STATGROUP_SpatialNet);
+
 void USpatialMetrics::Init(USpatialNetDriver* InNetDriver)
 {
 	NetDriver = InNetDriver;
@@ -24,6 +27,9 @@ void USpatialMetrics::Init(USpatialNetDriver* InNetDriver)
 
 	bRPCTrackingEnabled = false;
 	RPCTrackingStartTime = 0.0f;
+
+	ComponentUpdatesQueuedSinceLastReport = 0;
+	ComponentUpdatesSentSinceLastReport = 0;
 }
 
 void USpatialMetrics::TickMetrics()
@@ -49,12 +55,38 @@ void USpatialMetrics::TickMetrics()
 	DynamicFPSMetrics.GaugeMetrics.Add(DynamicFPSGauge);
 	DynamicFPSMetrics.Load = WorkerLoad;
 
+	if (GetDefault<USpatialGDKSettings>()->bCoalesceComponentUpdates)
+	{
+		// Reported per second so they are comparable across report rates.
+		SpatialGDK::GaugeMetric ComponentUpdatesQueuedGauge;
+		ComponentUpdatesQueuedGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_COMPONENT_UPDATES_QUEUED);
+		ComponentUpdatesQueuedGauge.Value = ComponentUpdatesQueuedSinceLastReport / TimeSinceLastReport;
+		DynamicFPSMetrics.GaugeMetrics.Add(ComponentUpdatesQueuedGauge);
+
+		SpatialGDK::GaugeMetric ComponentUpdatesSentGauge;
+		ComponentUpdatesSentGauge.Key = TCHAR_TO_UTF8(*SpatialConstants::SPATIALOS_METRICS_COMPONENT_UPDATES_SENT);
+		ComponentUpdatesSentGauge.Value = ComponentUpdatesSentSinceLastReport / TimeSinceLastReport;
+		DynamicFPSMetrics.GaugeMetrics.Add(ComponentUpdatesSentGauge);
+
+		ComponentUpdatesQueuedSinceLastReport = 0;
+		ComponentUpdatesSentSinceLastReport = 0;
+	}
+
 	TimeOfLastReport = NetDriver->Time;
 	FramesSinceLastReport = 0;
 
 	NetDriver->Connection->SendMetrics(DynamicFPSMetrics);
 }
 
+void USpatialMetrics::TrackCoalescedComponentUpdates(uint32 QueuedCount, uint32 SentCount)
+{
+	ComponentUpdatesQueuedSinceLastReport += QueuedCount;
+	ComponentUpdatesSentSinceLastReport += SentCount;
+
+	INC_DWORD_STAT_BY(STAT_SpatialComponentUpdatesQueued, QueuedCount);
+	INC_DWORD_STAT_BY(STAT_SpatialComponentUpdatesSent, SentCount);
+}
+
 // Load defined as performance relative to target frame time or just frame time based on config value.
 double USpatialMetrics::CalculateLoad() const
 {
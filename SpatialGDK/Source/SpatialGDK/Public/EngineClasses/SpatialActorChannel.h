@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/ActorChannel.h"
+#include "Engine/EngineTypes.h"
 
 #include "EngineClasses/SpatialNetDriver.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
@@ -120,6 +121,11 @@ public:
 	virtual int64 ReplicateActor() override;
 	virtual void SetChannelActor(AActor* InActor) override;
 
+	// Runs the property comparison ReplicateActor would do for the actor and its replicated subobjects this frame.
+	// It only touches this channel's replicators and the replicated objects, so it can run on a worker thread for
+	// different channels in parallel. ReplicateActor then reuses the result for the current ReplicationFrame.
+	void CompareReplicatedProperties();
+
 	bool TryResolveActor();
 
 	bool ReplicateSubobject(UObject* Obj, const FReplicationFlags& RepFlags);
@@ -152,6 +158,16 @@ public:
 	FORCEINLINE void MarkInterestDirty() { bInterestDirty = true; }
 	FORCEINLINE bool GetInterestDirty() const { return bInterestDirty; }
 
+	// With dirty Actor replication, the Actor is only replicated again after it is marked dirty, moves, or its ReplicatedMovement changes.
+	FORCEINLINE void MarkReplicationDirty() { bReplicationDirty = true; }
+	bool CanSkipReplication() const;
+
+	// Priority accumulated over the ticks the Actor was prioritized but not replicated, added to its priority until it is replicated.
+	FORCEINLINE int32 GetDeferredPriority() const { return DeferredPriority; }
+	// Priority already includes the previously deferred priority, so storing it accumulates the priority of every deferred tick.
+	// Each deferral also adds DeferredPriorityIncrement, so that an Actor whose own priority is 0 still rises until it is replicated.
+	FORCEINLINE void DeferReplication(int32 Priority) { DeferredPriority = static_cast<int32>(FMath::Min<int64>(static_cast<int64>(Priority) + DeferredPriorityIncrement, MAX_int32)); }
+
 	FORCEINLINE void StartListening() { bIsListening = true; }
 	FORCEINLINE bool IsListening() { return bIsListening; }
 	const FClassInfo* TryResolveNewDynamicSubobjectAndGetClassInfo(UObject* Object);
@@ -189,6 +205,16 @@ private:
 	bool bInterestDirty;
 	bool bIsListening;
 
+	// Set when the Actor's class uses dirty Actor replication.
+	bool bDirtyReplicationEnabled;
+	bool bReplicationDirty;
+	FVector LocationWhenLastReplicated;
+	FRepMovement MovementWhenLastReplicated;
+
+	int32 DeferredPriority;
+	// One second's worth of priority for an Actor with a NetPriority of 1, see AActor::GetNetPriority.
+	static constexpr int32 DeferredPriorityIncrement = 65536;
+
 	// Used on the client to track gaining/losing ownership.
 	bool bNetOwned;
 	// Used on the server to track when the owner changes.
@@ -46,7 +46,6 @@ public:
 	// End NetConnection Interface
 
 	void InitHeartbeat(class FTimerManager* InTimerManager, Worker_EntityId InPlayerControllerEntity);
-	void SetHeartbeatTimeoutTimer();
 	void SetHeartbeatEventTimer();
 
 	void DisableHeartbeat();
@@ -66,5 +65,8 @@ public:
 
 	// Player lifecycle
 	Worker_EntityId PlayerControllerEntity;
+	// Used on the client to send heartbeats.
 	FTimerHandle HeartbeatTimer;
+	// Used on the server, where heartbeats are tracked by the net driver's FHeartbeatTracker.
+	int32 HeartbeatTrackerSlot;
 };
@@ -13,6 +13,9 @@
 #include "Interop/SpatialOutputDevice.h"
 #include "SpatialConstants.h"
 #include "SpatialGDKSettings.h"
+#include "Utils/HeartbeatTracker.h"
+#include "Utils/RelevancyGrid.h"
+#include "Utils/SchemaScratch.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
 
@@ -100,6 +103,9 @@ public:
 	USpatialActorChannel* GetActorChannelByEntityId(Worker_EntityId EntityId) const;
 	USpatialActorChannel* CreateSpatialActorChannel(AActor* Actor, USpatialNetConnection* InConnection);
 
+	// Marks the Actor, or the Actor that owns the subobject, to be replicated again when using dirty Actor replication.
+	void MarkActorDirty(UObject* Object);
+
 	DECLARE_DELEGATE(PostWorldWipeDelegate);
 
 	void WipeWorld(const USpatialNetDriver::PostWorldWipeDelegate& LoadSnapshotAfterWorldWipe);
@@ -133,8 +139,14 @@ public:
 	UPROPERTY()
 	ASpatialMetricsDisplay* SpatialMetricsDisplay;
 
+	// Reused by every ComponentFactory when serializing properties, see FSchemaScratch.
+	TUniquePtr<SpatialGDK::FSchemaScratch> SchemaScratch;
+
 	Worker_EntityId WorkerEntityId = SpatialConstants::INVALID_ENTITY_ID;
 
+	// Tracks heartbeats of the client connections this server-worker is authoritative over.
+	FHeartbeatTracker HeartbeatTracker;
+
 	TMap<UClass*, TPair<AActor*, USpatialActorChannel*>> SingletonActorChannels;
 
 	bool IsAuthoritativeDestructionAllowed() const { return bAuthoritativeDestruction; }
@@ -214,6 +226,7 @@ private:
 	int32 ServerReplicateActors_PrepConnections(const float DeltaSeconds);
 	int32 ServerReplicateActors_PrioritizeActors(UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, const TArray<FNetworkObjectInfo*> ConsiderList, const bool bCPUSaturated, FActorPriority*& OutPriorityList, FActorPriority**& OutPriorityActors);
 	void ServerReplicateActors_ProcessPrioritizedActors(UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers, FActorPriority** PriorityActors, const int32 FinalSortedCount, int32& OutUpdated);
+	void CompareReplicatedPropertiesInParallel(FActorPriority** PriorityActors, const int32 FinalSortedCount, const int32 MaxActorsToReplicate);
 #endif
 
 	void ProcessRPC(AActor* Actor, UObject* SubObject, UFunction* Function, void* Parameters);
@@ -235,6 +248,9 @@ private:
 
 	FDelegateHandle SpatialDeploymentStartHandle;
 
+	// Only created when bUseRelevancyGrid is enabled, see ServerReplicateActors_PrioritizeActors.
+	TUniquePtr<FRelevancyGrid> RelevancyGrid;
+
 #if !UE_BUILD_SHIPPING
 	int32 ConsiderListSize = 0;
 #endif
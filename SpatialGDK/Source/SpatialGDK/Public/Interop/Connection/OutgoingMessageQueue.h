@@ -0,0 +1,147 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Queue.h"
+#include "HAL/Platform.h"
+#include "HAL/PlatformTime.h"
+#include "Templates/Atomic.h"
+#include "Templates/UnrealTemplate.h"
+
+#include "Interop/Connection/OutgoingMessages.h"
+
+namespace SpatialGDK
+{
+
+// In-place storage for a single outgoing message of any type.
+// Destruction and moves are dispatched on the message type rather than through a vtable.
+class SPATIALGDK_API FOutgoingMessageSlot
+{
+public:
+	FOutgoingMessageSlot() : bIsSet(false) {}
+	FOutgoingMessageSlot(FOutgoingMessageSlot&& Other);
+	FOutgoingMessageSlot& operator=(FOutgoingMessageSlot&& Other);
+	~FOutgoingMessageSlot() { Reset(); }
+
+	FOutgoingMessageSlot(const FOutgoingMessageSlot&) = delete;
+	FOutgoingMessageSlot& operator=(const FOutgoingMessageSlot&) = delete;
+
+	template <typename T, typename... ArgsType>
+	T& Emplace(ArgsType&&... Args)
+	{
+		static_assert(sizeof(T) <= sizeof(FStorage) && alignof(T) <= alignof(FStorage), "Outgoing message type does not fit in FOutgoingMessageSlot.");
+
+		Reset();
+		T* Message = new (&Storage) T(Forward<ArgsType>(Args)...);
+		bIsSet = true;
+		return *Message;
+	}
+
+	void Reset();
+
+	bool IsSet() const { return bIsSet; }
+
+	FOutgoingMessage* Get() { return bIsSet ? reinterpret_cast<FOutgoingMessage*>(&Storage) : nullptr; }
+
+private:
+	void MoveFrom(FOutgoingMessageSlot& Other);
+
+	// Only used to size and align the storage for the largest message type.
+	union FStorage
+	{
+		FReserveEntityIdsRequest ReserveEntityIdsRequest;
+		FCreateEntityRequest CreateEntityRequest;
+		FDeleteEntityRequest DeleteEntityRequest;
+		FAddComponent AddComponent;
+		FRemoveComponent RemoveComponent;
+		FComponentUpdate ComponentUpdate;
+		FCommandRequest CommandRequest;
+		FCommandResponse CommandResponse;
+		FCommandFailure CommandFailure;
+		FLogMessage LogMessage;
+		FComponentInterest ComponentInterest;
+		FEntityQueryRequest EntityQueryRequest;
+		FMetrics Metrics;
+
+		FStorage() {}
+		~FStorage() {}
+	};
+
+	FStorage Storage;
+	bool bIsSet;
+};
+
+// Fixed-capacity single-producer single-consumer ring of outgoing messages.
+// The game thread produces and the worker connection thread consumes. Messages are constructed in place, so queueing
+// does not allocate. If the consumer falls behind and the ring fills up, messages spill into an overflow queue (which
+// does allocate) and are moved back into the ring, in order, as space frees up.
+class SPATIALGDK_API FOutgoingMessageQueue
+{
+public:
+	explicit FOutgoingMessageQueue(uint32 InCapacity);
+
+	FOutgoingMessageQueue(const FOutgoingMessageQueue&) = delete;
+	FOutgoingMessageQueue& operator=(const FOutgoingMessageQueue&) = delete;
+
+	// Producer interface.
+	template <typename T, typename... ArgsType>
+	void Enqueue(ArgsType&&... Args)
+	{
+		FlushOverflow();
+
+		if (NumOverflowMessages > 0 || IsFull())
+		{
+			FOutgoingMessageSlot OverflowSlot;
+			T& Message = OverflowSlot.Emplace<T>(Forward<ArgsType>(Args)...);
+			Message.QueuedTimeCycles = FPlatformTime::Cycles64();
+			OverflowQueue.Enqueue(MoveTemp(OverflowSlot));
+			OverflowCount++;
+			NumOverflowMessages++;
+			UpdateHighWaterMark();
+			return;
+		}
+
+		const uint32 CurrentHead = Head.Load();
+		T& Message = Slots[CurrentHead & IndexMask].Emplace<T>(Forward<ArgsType>(Args)...);
+		Message.QueuedTimeCycles = FPlatformTime::Cycles64();
+		Head.Store(CurrentHead + 1);
+
+		UpdateHighWaterMark();
+	}
+
+	// Moves as many overflowed messages as fit back into the ring. Producer only.
+	void FlushOverflow();
+
+	// Consumer interface.
+	FOutgoingMessage* Peek();
+	void Pop();
+
+	uint32 GetCapacity() const { return Capacity; }
+	uint32 Num() const { return Head.Load() - Tail.Load(); }
+
+	// Highest number of messages waiting in the ring plus overflow since the last reset. Producer only.
+	uint32 GetHighWaterMark() const { return HighWaterMark; }
+	// Number of messages that did not fit in the ring since the last reset. Producer only.
+	uint32 GetOverflowCount() const { return OverflowCount; }
+	void ResetCounters();
+
+private:
+	bool IsFull() const { return Head.Load() - Tail.Load() >= Capacity; }
+	void UpdateHighWaterMark();
+
+	uint32 Capacity;
+	uint32 IndexMask;
+	TArray<FOutgoingMessageSlot> Slots;
+
+	// Monotonically increasing; the slot index is the counter masked by IndexMask.
+	TAtomic<uint32> Head;
+	TAtomic<uint32> Tail;
+
+	TQueue<FOutgoingMessageSlot, EQueueMode::Spsc> OverflowQueue;
+	uint32 NumOverflowMessages;
+
+	uint32 HighWaterMark;
+	uint32 OverflowCount;
+};
+
+} // namespace SpatialGDK
@@ -35,10 +35,12 @@ enum class EOutgoingMessageType : int32
 
 struct FOutgoingMessage
 {
-	FOutgoingMessage(const EOutgoingMessageType& InType) : Type(InType) {}
-	virtual ~FOutgoingMessage() {}
+	FOutgoingMessage(const EOutgoingMessageType& InType) : Type(InType), QueuedTimeCycles(0) {}
 
 	EOutgoingMessageType Type;
+
+	// FPlatformTime::Cycles64() at the point the message was queued, used to measure queue-to-send latency.
+	uint64 QueuedTimeCycles;
 };
 
 struct FReserveEntityIdsRequest : FOutgoingMessage
@@ -181,8 +183,10 @@ struct FEntityQueryRequest : FOutgoingMessage
 	{
 		if (EntityQuery.snapshot_result_type_component_ids != nullptr)
 		{
-			ComponentIdStorage.SetNum(EntityQuery.snapshot_result_type_component_id_count);
-			FMemory::Memcpy(static_cast<void*>(ComponentIdStorage.GetData()), static_cast<const void*>(EntityQuery.snapshot_result_type_component_ids), ComponentIdStorage.Num());
+			// Reserve at least one element so that an empty list, which asks for entity ids only, stays distinct from a null one.
+			ComponentIdStorage.Reserve(FMath::Max(1u, EntityQuery.snapshot_result_type_component_id_count));
+			ComponentIdStorage.Append(EntityQuery.snapshot_result_type_component_ids, EntityQuery.snapshot_result_type_component_id_count);
+			EntityQuery.snapshot_result_type_component_ids = ComponentIdStorage.GetData();
 		}
 
 		TraverseConstraint(&EntityQuery.constraint);
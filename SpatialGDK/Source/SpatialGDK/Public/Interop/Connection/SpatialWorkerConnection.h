@@ -2,11 +2,14 @@
 #pragma once
 
 #include "Containers/Queue.h"
+#include "HAL/Event.h"
 #include "HAL/Runnable.h"
 #include "HAL/ThreadSafeBool.h"
 
 #include "Interop/Connection/ConnectionConfig.h"
+#include "Interop/Connection/OutgoingMessageQueue.h"
 #include "Interop/Connection/OutgoingMessages.h"
+#include "Interop/DecodedOps.h"
 #include "SpatialGDKSettings.h"
 #include "UObject/WeakObjectPtr.h"
 
@@ -44,6 +47,9 @@ public:
 
 	// Worker Connection Interface
 	TArray<Worker_OpList*> GetOpList();
+	// Returns the component updates decoded on the ops thread for an op list returned by GetOpList, if any.
+	// Ownership passes to the caller.
+	TUniquePtr<SpatialGDK::FDecodedOpList> TakeDecodedOpList(const Worker_OpList* OpList);
 	Worker_RequestId SendReserveEntityIdsRequest(uint32_t NumOfEntities);
 	Worker_RequestId SendCreateEntityRequest(TArray<Worker_ComponentData>&& Components, const Worker_EntityId* EntityId);
 	Worker_RequestId SendDeleteEntityRequest(Worker_EntityId EntityId);
@@ -86,9 +92,12 @@ private:
 	// End FRunnable Interface
 
 	void InitializeOpsProcessingThread();
-	void QueueLatestOpList();
+	void QueueLatestOpList(uint32 TimeoutMs);
 	void ProcessOutgoingMessages();
 
+	void RecordOutgoingMessageLatency(uint64 LatencyCycles);
+	void PublishOutgoingMessageStats();
+
 	void StartDevelopmentAuth(FString DevAuthToken);
 	static void OnPlayerIdentityToken(void* UserData, const Worker_Alpha_PlayerIdentityTokenResponse* PIToken);
 	static void OnLoginTokens(void* UserData, const Worker_Alpha_LoginTokensResponse* LoginTokens);
@@ -110,8 +119,25 @@ private:
 	FThreadSafeBool KeepRunning = true;
 	float OpsUpdateInterval;
 
-	TQueue<Worker_OpList*> OpListQueue;
-	TQueue<TUniquePtr<SpatialGDK::FOutgoingMessage>> OutgoingMessagesQueue;
+	// Set from bWakeOpsThreadOnDemand, the ops thread then waits on the connection for up to OpListTimeoutMs instead of sleeping.
+	bool bWaitOnOpList = false;
+	uint32 OpListTimeoutMs = 0;
+
+	// Queue-to-send latency of outgoing messages. Accumulated on the ops thread, consumed on the game thread.
+	volatile int64 SentMessageCount = 0;
+	volatile int64 SentMessageLatencyCycles = 0;
+	volatile int64 MaxSentMessageLatencyCycles = 0;
+
+	struct FQueuedOpList
+	{
+		Worker_OpList* OpList;
+		TUniquePtr<SpatialGDK::FDecodedOpList> DecodedOps;
+	};
+
+	bool bPreDecodeComponentUpdates = false;
+	TQueue<FQueuedOpList> OpListQueue;
+	TMap<const Worker_OpList*, TUniquePtr<SpatialGDK::FDecodedOpList>> DecodedOpLists;
+	TUniquePtr<SpatialGDK::FOutgoingMessageQueue> OutgoingMessagesQueue;
 
 	// RequestIds per worker connection start at 0 and incrementally go up each command sent.
 	Worker_RequestId NextRequestId = 0;
@@ -0,0 +1,67 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Schema/RPCPayload.h"
+#include "Schema/StandardLibrary.h"
+#include "SpatialCommonTypes.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+
+struct FDecodedRPCEvent
+{
+	FDecodedRPCEvent(const Schema_Object* EventData, bool bPacked);
+
+	RPCPayload Payload;
+	// Only set for packed RPCs, which are sent through the PlayerController and carry their actual target entity.
+	Worker_EntityId PackedTargetEntityId;
+};
+
+// Plain-data form of a component update to a well-known component. Decoded on the worker connection thread
+// so that the game thread only has to apply the result.
+struct FDecodedComponentUpdate
+{
+	// Position
+	TOptional<Coordinates> Coords;
+
+	// EntityAcl
+	TOptional<WorkerRequirementSet> ReadAcl;
+	TOptional<WriteAclMap> ComponentWriteAcl;
+
+	// Client, server and multicast RPC endpoints
+	TOptional<bool> bRPCEndpointReady;
+	TArray<FDecodedRPCEvent> RPCEvents;
+	TArray<FDecodedRPCEvent> PackedRPCEvents;
+
+	// Heartbeat
+	uint32 HeartbeatEventCount = 0;
+	bool bClientHasQuit = false;
+};
+
+// Decoded component updates for a single op list, indexed by the position of the op in the list.
+class SPATIALGDK_API FDecodedOpList
+{
+public:
+	static bool IsDecodable(Worker_ComponentId ComponentId);
+
+	explicit FDecodedOpList(const Worker_OpList* InOpList);
+
+	FDecodedComponentUpdate* GetComponentUpdate(const Worker_Op* Op);
+
+	int32 Num() const { return Updates.Num(); }
+
+private:
+	static void DecodeComponentUpdate(const Worker_ComponentUpdate& Update, FDecodedComponentUpdate& OutDecoded);
+
+	const Worker_OpList* OpList;
+	TArray<int32> UpdateIndexByOp;
+	TArray<FDecodedComponentUpdate> Updates;
+};
+
+} // namespace SpatialGDK
@@ -2,10 +2,12 @@
 
 #pragma once
 
+#include "Async/Future.h"
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 
 #include "EngineClasses/SpatialNetDriver.h"
+#include "Utils/EntityDeleteBatcher.h"
 #include "Utils/SchemaUtils.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
@@ -28,9 +30,50 @@ public:
 
 	void WorldWipe(const USpatialNetDriver::PostWorldWipeDelegate& Delegate);
 	void DeleteEntities(const Worker_EntityQueryResponseOp& Op);
-	void LoadSnapshot(const FString& SnapshotName);
+	bool IsWipingWorld() const { return WorldWipeBatcher.IsValid(); }
+
+	// Called once the load has finished, with whether every entity in the snapshot was sent to be created. A failed load leaves
+	// the entities created before the failure in the world, and the deployment doesn't start accepting players.
+	DECLARE_DELEGATE_OneParam(PostSnapshotLoadDelegate, bool /* bSuccess */);
+
+	void LoadSnapshot(const FString& SnapshotName, const PostSnapshotLoadDelegate& Delegate = PostSnapshotLoadDelegate());
+
+	// Snapshots are loaded in chunks over several ticks. Collects chunks that finished reading, starts reading the next one,
+	// and sends the create entity requests the rate limit allows. Called from the net driver every tick.
+	void FlushSnapshotLoad();
+
+	virtual void BeginDestroy() override;
 
 private:
+	struct FSnapshotChunk
+	{
+		TArray<TArray<Worker_ComponentData>> Entities;
+		FString Error;
+		bool bEndOfSnapshot = false;
+	};
+
+	struct FEntityToCreate
+	{
+		Worker_EntityId EntityId;
+		TArray<Worker_ComponentData> Components;
+	};
+
+	void ReadNextChunk();
+	void ReserveEntityIds(const TSharedPtr<FSnapshotChunk>& Chunk);
+	void SendReserveEntityIdsRequest(const TSharedPtr<FSnapshotChunk>& Chunk, int32 Attempt);
+	void SendCreateEntityRequests(double Now);
+	int32 GetNumEntitiesPending() const;
+	void FinishLoadingSnapshot(double Now);
+	void FailLoadingSnapshot();
+	void AbortLoadingSnapshot();
+	void ResetSnapshotLoad();
+
+	static void DestroyEntities(TArray<TArray<Worker_ComponentData>>& Entities);
+
+	void SendWorldWipeDeletes();
+	void OnWorldWipeDeleteResponse(const Worker_DeleteEntityResponseOp& Op);
+	void FinishWorldWipe();
+
 	UPROPERTY()
 	USpatialNetDriver* NetDriver;
 
@@ -39,4 +82,33 @@ private:
 
 	UPROPERTY()
 	USpatialReceiver* Receiver;
+
+	// The stream is only read by the chunk task, and is destroyed once the last chunk has been read.
+	Worker_SnapshotInputStream* SnapshotStream = nullptr;
+	TFuture<TSharedPtr<FSnapshotChunk>> ChunkFuture;
+	FString SnapshotPath;
+	PostSnapshotLoadDelegate PostSnapshotLoad;
+
+	bool bLoadingSnapshot = false;
+	bool bSnapshotFullyRead = false;
+
+	// Incremented whenever a load ends, so that reservations made by an aborted load are discarded when they arrive.
+	uint32 SnapshotLoadId = 0;
+
+	// Entities that have ids and are waiting for the rate limit, sent from NextEntityToCreate onwards.
+	TArray<FEntityToCreate> EntitiesToCreate;
+	int32 NextEntityToCreate = 0;
+	int32 NumEntitiesReserving = 0;
+
+	int32 NumEntitiesRead = 0;
+	int32 NumEntitiesCreated = 0;
+	double EntityBudget = 0.0;
+	double LastFlushTime = 0.0;
+	double LoadStartTime = 0.0;
+	double LastProgressLogTime = 0.0;
+
+	TUniquePtr<FEntityDeleteBatcher> WorldWipeBatcher;
+	USpatialNetDriver::PostWorldWipeDelegate PostWorldWipe;
+	double WorldWipeStartTime = 0.0;
+	double LastWorldWipeProgressLogTime = 0.0;
 };
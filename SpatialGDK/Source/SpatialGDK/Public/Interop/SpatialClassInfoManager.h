@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Async/Future.h"
 #include "CoreMinimal.h"
 #include "Utils/SchemaDatabase.h"
 
@@ -41,6 +42,20 @@ struct FHandoverPropertyInfo
 	int32 Offset;
 	int32 ArrayIdx;
 	UProperty* Property;
+	// Offset of this property in the handover shadow data of its object.
+	int32 ShadowOffset;
+};
+
+// A run of handover properties that are contiguous both in the object and in its shadow data. When all of them can be compared
+// byte for byte, the whole run is compared with one memcmp and copied with one memcpy. Other properties get a run of their own.
+struct FHandoverShadowSpan
+{
+	int32 Offset;
+	int32 ShadowOffset;
+	int32 Size;
+	int32 FirstProperty;
+	int32 NumProperties;
+	bool bTriviallyComparable;
 };
 
 struct FInterestPropertyInfo
@@ -60,6 +75,8 @@ struct FClassInfo
 	TArray<UFunction*> RPCs;
 	TMap<UFunction*, FRPCInfo> RPCInfoMap;
 	TArray<FHandoverPropertyInfo> HandoverProperties;
+	TArray<FHandoverShadowSpan> HandoverShadowSpans;
+	int32 HandoverShadowDataSize = 0;
 	TArray<FInterestPropertyInfo> InterestProperties;
 
 	// For Actors and default Subobjects belonging to Actors
@@ -105,6 +122,7 @@ public:
 	ESchemaComponentType GetCategoryByComponentId(Worker_ComponentId ComponentId);
 
 	Worker_ComponentId GetComponentIdForClass(const UClass& Class) const;
+	// Results including derived types are cached until class info is next added for a class.
 	TArray<Worker_ComponentId> GetComponentIdsForClassHierarchy(const UClass& BaseClass, const bool bIncludeDerivedTypes = true) const;
 	
 	const FRPCInfo& GetRPCInfo(UObject* Object, UFunction* Function);
@@ -112,6 +130,9 @@ public:
 	uint32 GetComponentIdFromLevelPath(const FString& LevelPath);
 	bool IsSublevelComponent(Worker_ComponentId ComponentId);
 
+	// Adds the class info built in the background once it is ready, see bPrebuildClassInfoInBackground.
+	void PollPrebuiltClassInfo();
+
 	UPROPERTY()
 	USchemaDatabase* SchemaDatabase;
 
@@ -119,6 +140,14 @@ private:
 	void CreateClassInfoForClass(UClass* Class);
 	void TryCreateClassInfoForComponentId(Worker_ComponentId ComponentId);
 
+	// Builds the class info of every class in the SchemaDatabase up front, see bPrebuildClassInfo.
+	void PrebuildClassInfo();
+	void FinishPrebuildingClassInfo();
+	void AddPrebuiltClassInfo(const TArray<TSharedRef<FClassInfo>>& PrebuiltInfos);
+
+	void AddClassInfo(const FString& ClassPath, TSharedRef<FClassInfo> Info);
+	SIZE_T GetClassInfoAllocatedSize() const;
+
 	void FinishConstructingActorClassInfo(const FString& ClassPath, TSharedRef<FClassInfo>& Info);
 	void FinishConstructingSubobjectClassInfo(const FString& ClassPath, TSharedRef<FClassInfo>& Info);
 
@@ -135,4 +164,14 @@ private:
 	TMap<Worker_ComponentId, TSharedRef<FClassInfo>> ComponentToClassInfoMap;
 	TMap<Worker_ComponentId, uint32> ComponentToOffsetMap;
 	TMap<Worker_ComponentId, ESchemaComponentType> ComponentToCategoryMap;
+
+	// Walking every loaded class is too slow to do for each interest query, see GetComponentIdsForClassHierarchy.
+	mutable TMap<TWeakObjectPtr<const UClass>, TArray<Worker_ComponentId>> ClassHierarchyComponentIds;
+
+	// Keeps the prebuilt classes loaded, so that they aren't loaded again on first use.
+	UPROPERTY()
+	TArray<UClass*> PrebuiltClasses;
+
+	TFuture<TArray<TSharedRef<FClassInfo>>> PrebuiltClassInfoFuture;
+	double PrebuildStartTime = 0.0;
 };
@@ -27,6 +27,11 @@ class USpatialNetConnection;
 class USpatialSender;
 class UGlobalStateManager;
 
+namespace SpatialGDK
+{
+struct FDecodedComponentUpdate;
+}
+
 struct PendingAddComponentWrapper
 {
 	PendingAddComponentWrapper() = default;
@@ -80,6 +85,15 @@ struct FObjectReferences
 	UProperty*							Property;
 };
 
+// Properties of one replicated object that are waiting on unresolved object refs.
+struct FUnresolvedObjectRefs
+{
+	FObjectReferencesMap ObjectReferencesMap;
+
+	// The refs this object is listed under in IncomingRefsMap, so it can be removed from there without a search.
+	TSet<FUnrealObjectRef> IncomingRefs;
+};
+
 struct FPendingIncomingRPC
 {
 	FPendingIncomingRPC(const TSet<FUnrealObjectRef>& InUnresolvedRefs, UObject* InTargetObject, UFunction* InFunction, const SpatialGDK::RPCPayload& InPayload)
@@ -106,6 +120,7 @@ using FIncomingRPCArray = TArray<TSharedPtr<FPendingIncomingRPC>>;
 DECLARE_DELEGATE_OneParam(EntityQueryDelegate, const Worker_EntityQueryResponseOp&);
 DECLARE_DELEGATE_OneParam(ReserveEntityIDsDelegate, const Worker_ReserveEntityIdsResponseOp&);
 DECLARE_DELEGATE_OneParam(CreateEntityDelegate, const Worker_CreateEntityResponseOp&);
+DECLARE_DELEGATE_OneParam(DeleteEntityDelegate, const Worker_DeleteEntityResponseOp&);
 
 UCLASS()
 class USpatialReceiver : public UObject
@@ -125,16 +140,19 @@ public:
 	void RemoveComponentOpsForEntity(Worker_EntityId EntityId);
 	void OnAuthorityChange(const Worker_AuthorityChangeOp& Op);
 
-	void OnComponentUpdate(const Worker_ComponentUpdateOp& Op);
-	void HandleRPC(const Worker_ComponentUpdateOp& Op);
+	// DecodedUpdate is set if the update was already decoded on the worker connection thread, see FDecodedOpList.
+	void OnComponentUpdate(const Worker_ComponentUpdateOp& Op, SpatialGDK::FDecodedComponentUpdate* DecodedUpdate = nullptr);
+	void HandleRPC(const Worker_ComponentUpdateOp& Op, SpatialGDK::FDecodedComponentUpdate* DecodedUpdate = nullptr);
 
 	void ProcessRPCEventField(Worker_EntityId EntityId, const Worker_ComponentUpdateOp &Op, const Worker_ComponentId RPCEndpointComponentId, bool bPacked);
+	void ProcessDecodedRPCEvents(Worker_EntityId EntityId, const Worker_ComponentUpdateOp& Op, const Worker_ComponentId RPCEndpointComponentId, SpatialGDK::FDecodedComponentUpdate& DecodedUpdate, bool bPacked);
 
 	void OnCommandRequest(const Worker_CommandRequestOp& Op);
 	void OnCommandResponse(const Worker_CommandResponseOp& Op);
 
 	void OnReserveEntityIdsResponse(const Worker_ReserveEntityIdsResponseOp& Op);
 	void OnCreateEntityResponse(const Worker_CreateEntityResponseOp& Op);
+	void OnDeleteEntityResponse(const Worker_DeleteEntityResponseOp& Op);
 
 	void AddPendingActorRequest(Worker_RequestId RequestId, USpatialActorChannel* Channel);
 	void AddPendingReliableRPC(Worker_RequestId RequestId, TSharedRef<struct FReliableRPCForRetry> ReliableRPC);
@@ -142,6 +160,7 @@ public:
 	void AddEntityQueryDelegate(Worker_RequestId RequestId, EntityQueryDelegate Delegate);
 	void AddReserveEntityIdsDelegate(Worker_RequestId RequestId, ReserveEntityIDsDelegate Delegate);
 	void AddCreateEntityDelegate(Worker_RequestId RequestId, const CreateEntityDelegate& Delegate);
+	void AddDeleteEntityDelegate(Worker_RequestId RequestId, const DeleteEntityDelegate& Delegate);
 
 	void OnEntityQueryResponse(const Worker_EntityQueryResponseOp& Op);
 
@@ -150,6 +169,14 @@ public:
 	void ResolvePendingOperations(UObject* Object, const FUnrealObjectRef& ObjectRef);
 	void FlushRetryRPCs();
 
+	// Objects resolved between these calls are only patched into the properties and RPCs waiting on them by
+	// FlushResolvedObjectRefs, so that each waiting object is resolved once however many of its refs were resolved.
+	void BeginBatchingResolvedObjectRefs();
+	void FlushResolvedObjectRefs();
+
+	// Drops the properties of the channel's objects that are waiting on unresolved object refs.
+	void CleanupUnresolvedRefs(USpatialActorChannel* Channel);
+
 	void OnDisconnect(Worker_DisconnectOp& Op);
 
 private:
@@ -181,24 +208,31 @@ private:
 	void ApplyComponentUpdate(const Worker_ComponentUpdate& ComponentUpdate, UObject* TargetObject, USpatialActorChannel* Channel, bool bIsHandover);
 
 	void RegisterListeningEntityIfReady(Worker_EntityId EntityId, Schema_Object* Object);
+	void RegisterListeningEntityIfReady(Worker_EntityId EntityId, bool bReady);
 
-	bool ApplyRPC(const FPendingRPCParams& Params);
-	bool ApplyRPC(UObject* TargetObject, UFunction* Function, const SpatialGDK::RPCPayload& Payload, const FString& SenderWorkerId);	
+	EProcessRPCResult ApplyQueuedRPC(const FPendingRPCParams& Params);
+	bool ApplyRPC(UObject* TargetObject, UFunction* Function, const SpatialGDK::RPCPayloadView& Payload, const FString& SenderWorkerId);
 
 	void ReceiveCommandResponse(const Worker_CommandResponseOp& Op);
 
 	bool IsReceivedEntityTornOff(Worker_EntityId EntityId);
 
-	void QueueIncomingRepUpdates(FChannelObjectPair ChannelObjectPair, const FObjectReferencesMap& ObjectReferencesMap, const TSet<FUnrealObjectRef>& UnresolvedRefs);
+	FObjectReferencesMap& GetUnresolvedRefsForUpdate(const FChannelObjectPair& ChannelObjectPair);
+	FUnresolvedObjectRefs* FindUnresolvedRefs(const FChannelObjectPair& ChannelObjectPair);
+	void QueueIncomingRepUpdates(const FChannelObjectPair& ChannelObjectPair, const TSet<FUnrealObjectRef>& UnresolvedRefs);
+	void RemoveUnresolvedRefs(const FChannelObjectPair& ChannelObjectPair);
+	void RemoveIncomingRefs(const FChannelObjectPair& ChannelObjectPair, const TSet<FUnrealObjectRef>& IncomingRefs);
 
 	void QueueIncomingRPC(FPendingRPCParamsPtr Params);
 
 	void ResolvePendingOperations_Internal(UObject* Object, const FUnrealObjectRef& ObjectRef);
-	void ResolveIncomingOperations(UObject* Object, const FUnrealObjectRef& ObjectRef);
+	void ResolveIncomingOperations();
 
 	void ResolveIncomingRPCs();
 
 	void ResolveObjectReferences(FRepLayout& RepLayout, UObject* ReplicatedObject, FObjectReferencesMap& ObjectReferencesMap, uint8* RESTRICT StoredData, uint8* RESTRICT Data, int32 MaxAbsOffset, TArray<UProperty*>& RepNotifies, bool& bOutSomeObjectsWereMapped, bool& bOutStillHasUnresolved);
+	// Returns true if the references at AbsOffset are all resolved and can be removed.
+	bool ResolveObjectReferencesAtOffset(FRepLayout& RepLayout, UObject* ReplicatedObject, int32 AbsOffset, FObjectReferences& ObjectReferences, uint8* RESTRICT StoredData, uint8* RESTRICT Data, int32 MaxAbsOffset, TArray<UProperty*>& RepNotifies, bool& bOutSomeObjectsWereMapped, bool& bOutStillHasUnresolved);
 
 	void ProcessQueuedResolvedObjects();
 	void ProcessQueuedActorRPCsOnEntityCreation(AActor* Actor, SpatialGDK::RPCsOnEntityCreation& QueuedRPCs);
@@ -207,11 +241,12 @@ private:
 
 	AActor* FindSingletonActor(UClass* SingletonClass);
 
-	void OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp& Op);
+	void OnHeartbeatComponentUpdate(const Worker_ComponentUpdateOp& Op, SpatialGDK::FDecodedComponentUpdate* DecodedUpdate);
+	void ApplyPositionStream(Schema_Object* ComponentObject);
+	void ReceiveRPCEvent(const FUnrealObjectRef& ObjectRef, SpatialGDK::RPCPayload&& Payload);
+	bool TryApplyRPCEvent(const FUnrealObjectRef& ObjectRef, const SpatialGDK::RPCPayloadView& Payload);
 
 public:
-	TMap<FUnrealObjectRef, TSet<FChannelObjectPair>> IncomingRefsMap;
-
 	TMap<TPair<Worker_EntityId_Key, Worker_ComponentId>, TSharedRef<FPendingSubobjectAttachment>> PendingEntitySubobjectDelegations;
 
 private:
@@ -235,8 +270,13 @@ private:
 
 	FTimerManager* TimerManager;
 
-	// TODO: Figure out how to remove entries when Channel/Actor gets deleted - UNR:100
-	TMap<FChannelObjectPair, FObjectReferencesMap> UnresolvedRefsMap;
+	// Unresolved object refs, and for each the objects waiting on it with the offsets in their FObjectReferencesMap of
+	// the properties that reference it.
+	TMap<FUnrealObjectRef, TMap<FChannelObjectPair, TSet<int32>>> IncomingRefsMap;
+	// Kept per channel so that everything waiting on unresolved refs can be dropped when the channel is cleaned up.
+	TMap<TWeakObjectPtr<USpatialActorChannel>, TMap<TWeakObjectPtr<UObject>, FUnresolvedObjectRefs>> UnresolvedRefsMap;
+	TSet<FUnrealObjectRef> ResolvedIncomingRefs;
+	bool bBatchingResolvedObjectRefs = false;
 	TArray<TPair<UObject*, FUnrealObjectRef>> ResolvedObjectQueue;
 
 	TMap<FUnrealObjectRef, FIncomingRPCArray> IncomingRPCMap;
@@ -254,6 +294,7 @@ private:
 	TMap<Worker_RequestId, EntityQueryDelegate> EntityQueryDelegates;
 	TMap<Worker_RequestId, ReserveEntityIDsDelegate> ReserveEntityIDsDelegates;
 	TMap<Worker_RequestId, CreateEntityDelegate> CreateEntityDelegates;
+	TMap<Worker_RequestId, DeleteEntityDelegate> DeleteEntityDelegates;
 
 	// This will map PlayerController entities to the corresponding SpatialNetConnection
 	// for PlayerControllers that this server has authority over. This is used for player
@@ -8,6 +8,9 @@
 #include "Interop/SpatialClassInfoManager.h"
 #include "Schema/RPCPayload.h"
 #include "TimerManager.h"
+#include "Utils/ComponentUpdateCoalescer.h"
+#include "Utils/EntityCreationScheduler.h"
+#include "Utils/PositionStream.h"
 #include "Utils/RepDataUtils.h"
 #include "Utils/RPCContainer.h"
 
@@ -44,17 +47,6 @@ struct FReliableRPCForRetry
 	int RetryIndex; // Index for ordering reliable RPCs on subsequent tries
 };
 
-struct FPendingRPC
-{
-	FPendingRPC() = default;
-	FPendingRPC(FPendingRPC&& Other);
-
-	uint32 Offset;
-	Schema_FieldId Index;
-	TArray<uint8> Data;
-	Schema_EntityId Entity;
-};
-
 // TODO: Clear TMap entries when USpatialActorChannel gets deleted - UNR:100
 // care for actor getting deleted before actor channel
 using FChannelObjectPair = TPair<TWeakObjectPtr<USpatialActorChannel>, TWeakObjectPtr<UObject>>;
@@ -80,11 +72,13 @@ public:
 	void SendComponentInterestForSubobject(const FClassInfo& Info, Worker_EntityId EntityId, bool bNetOwned);
 	void SendPositionUpdate(Worker_EntityId EntityId, const FVector& Location);
 	bool SendRPC(const FPendingRPCParams& Params);
+	EProcessRPCResult SendQueuedRPC(const FPendingRPCParams& Params);
 	void SendCommandResponse(Worker_RequestId request_id, Worker_CommandResponse& Response);
 	void SendEmptyCommandResponse(Worker_ComponentId ComponentId, Schema_FieldId CommandIndex, Worker_RequestId RequestId);
 	void SendAddComponent(USpatialActorChannel* Channel, UObject* Subobject, const FClassInfo& Info);
 	void SendRemoveComponent(Worker_EntityId EntityId, const FClassInfo& Info);
 
+	// Queued when entity creation is budgeted, see FlushCreateEntityRequests.
 	void SendCreateEntityRequest(USpatialActorChannel* Channel);
 	void SendDeleteEntityRequest(Worker_EntityId EntityId);
 
@@ -106,12 +100,20 @@ public:
 
 	bool UpdateEntityACLs(Worker_EntityId EntityId, const FString& OwnerWorkerAttribute);
 	void UpdateInterestComponent(AActor* Actor);
+	// Drops the record of the last Interest sent for an entity, e.g. when authority over its Interest is lost.
+	void ForgetSentInterest(Worker_EntityId EntityId);
 
 	void ProcessRPC(FPendingRPCParamsPtr Params);
 	void QueueOutgoingRPC(FPendingRPCParamsPtr Params);
 	void ProcessUpdatesQueuedUntilAuthority(Worker_EntityId EntityId);
 
 	void FlushPackedRPCs();
+	void FlushComponentUpdates();
+	void FlushCreateEntityRequests();
+	void FlushPositionStream();
+
+	// Total serialized size of the property updates sent for replicated objects, counted while ReplicationBytesPerTick is set.
+	uint64 GetComponentUpdateBytes() const { return ComponentUpdateBytes; }
 
 	RPCPayload CreateRPCPayloadFromParams(UObject* TargetObject, UFunction* Function, int ReliableRPCIndex, void* Params, TSet<TWeakObjectPtr<const UObject>>& UnresolvedObjects);
 	void GainAuthorityThenAddComponent(USpatialActorChannel* Channel, UObject* Object, const FClassInfo* Info);
@@ -121,10 +123,16 @@ public:
 
 private:
 	// Actor Lifecycle
-	Worker_RequestId CreateEntity(USpatialActorChannel* Channel);
+	TArray<Worker_ComponentData> CreateEntityComponents(USpatialActorChannel* Channel);
+	Worker_RequestId CreateEntity(USpatialActorChannel* Channel, TArray<Worker_ComponentData>&& ComponentDatas);
+	EEntityCreationPriority GetEntityCreationPriority(const AActor* Actor) const;
 	Worker_ComponentData CreateLevelComponentData(AActor* Actor);
 
+	// Returns false if the serialized Interest is the same as the last one sent or created for this entity.
+	bool HasInterestChanged(Worker_EntityId EntityId, Schema_Object* InterestFields);
+
 	// Queuing
+	void SendOrCoalesceComponentUpdate(Worker_EntityId EntityId, Worker_ComponentUpdate& Update);
 	void ResetOutgoingUpdate(USpatialActorChannel* DependentChannel, UObject* ReplicatedObject, int16 Handle, bool bIsHandover);
 	void QueueOutgoingUpdate(USpatialActorChannel* DependentChannel, UObject* ReplicatedObject, int16 Handle, const TSet<TWeakObjectPtr<const UObject>>& UnresolvedObjects, bool bIsHandover);
 
@@ -179,5 +187,21 @@ private:
 
 	FChannelsToUpdatePosition ChannelsToUpdatePosition;
 
-	TMap<Worker_EntityId_Key, TArray<FPendingRPC>> RPCsToPack;
+	// Packed RPCs are written straight into the update for the PlayerController entity they go through, see AddPendingRPC.
+	TMap<Worker_EntityId_Key, Worker_ComponentUpdate> PackedRPCUpdates;
+
+	// Read once at Init, so updates already queued can't be stranded by the setting changing.
+	bool bCoalesceComponentUpdates = false;
+	FComponentUpdateCoalescer UpdateCoalescer;
+
+	FEntityCreationScheduler EntityCreationScheduler;
+
+	// With the position stream, moved entities are streamed every flush and their latest position is sent as a Position update at a lower rate.
+	FPositionStream PositionStream;
+	TMap<Worker_EntityId_Key, FVector> PendingPositionUpdates;
+	double TimeWhenPositionsLastSent = 0.0;
+
+	TMap<Worker_EntityId_Key, uint64> SentInterestHashes;
+
+	uint64 ComponentUpdateBytes = 0;
 };
@@ -14,6 +14,11 @@
 
 #include "SpatialStaticComponentView.generated.h"
 
+namespace SpatialGDK
+{
+struct FDecodedComponentUpdate;
+}
+
 UCLASS()
 class SPATIALGDK_API USpatialStaticComponentView : public UObject
 {
@@ -23,15 +28,20 @@ public:
 	Worker_Authority GetAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
 	bool HasAuthority(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
 
+	// Component data is stored contiguously per component type, so the returned pointer is only valid
+	// until the next component is added to or removed from the view.
 	template <typename T>
 	T* GetComponentData(Worker_EntityId EntityId)
 	{
-		if (TMap<Worker_ComponentId, TUniquePtr<SpatialGDK::ComponentStorageBase>>* ComponentStorageMap = EntityComponentMap.Find(EntityId))
+		const int32 EntitySlot = FindEntitySlot(EntityId);
+		if (EntitySlot == INDEX_NONE)
+		{
+			return nullptr;
+		}
+
+		if (SpatialGDK::ComponentColumnBase* Column = FindColumn(T::ComponentId))
 		{
-			if (TUniquePtr<SpatialGDK::ComponentStorageBase>* Component = ComponentStorageMap->Find(T::ComponentId))
-			{
-				return &(static_cast<SpatialGDK::ComponentStorage<T>*>(Component->Get())->Get());
-			}
+			return static_cast<SpatialGDK::ComponentColumn<T>*>(Column)->Get(EntitySlot);
 		}
 
 		return nullptr;
@@ -41,10 +51,41 @@ public:
 	void OnAddComponent(const Worker_AddComponentOp& Op);
 	void OnRemoveComponent(const Worker_RemoveComponentOp& Op);
 	void OnRemoveEntity(Worker_EntityId EntityId);
-	void OnComponentUpdate(const Worker_ComponentUpdateOp& Op);
+	// DecodedUpdate, if provided, holds the update already decoded off the game thread and is applied instead of the schema data.
+	void OnComponentUpdate(const Worker_ComponentUpdateOp& Op, SpatialGDK::FDecodedComponentUpdate* DecodedUpdate = nullptr);
 	void OnAuthorityChange(const Worker_AuthorityChangeOp& Op);
 
 private:
-	TMap<Worker_EntityId_Key, TMap<Worker_ComponentId, Worker_Authority>> EntityComponentAuthorityMap;
-	TMap<Worker_EntityId_Key, TMap<Worker_ComponentId, TUniquePtr<SpatialGDK::ComponentStorageBase>>> EntityComponentMap;
+	struct FEntityRecord
+	{
+		// Component ids this entity has data or authority for, so removing the entity only touches its own columns.
+		TArray<Worker_ComponentId, TInlineAllocator<16>> ComponentIds;
+	};
+
+	int32 FindEntitySlot(Worker_EntityId EntityId) const
+	{
+		const int32* EntitySlot = EntitySlots.Find(EntityId);
+		return EntitySlot != nullptr ? *EntitySlot : INDEX_NONE;
+	}
+
+	SpatialGDK::ComponentColumnBase* FindColumn(Worker_ComponentId ComponentId) const
+	{
+		return ColumnIndexByComponentId.IsValidIndex(ComponentId) && ColumnIndexByComponentId[ComponentId] != INDEX_NONE
+			? Columns[ColumnIndexByComponentId[ComponentId]].Get()
+			: nullptr;
+	}
+
+	void ApplyDecodedComponentUpdate(const Worker_ComponentUpdateOp& Op, SpatialGDK::FDecodedComponentUpdate& DecodedUpdate);
+
+	int32 FindOrAddEntitySlot(Worker_EntityId EntityId);
+	SpatialGDK::ComponentColumnBase& FindOrAddColumn(Worker_ComponentId ComponentId);
+
+	// Maps each entity in view to a dense slot, which indexes into every component column.
+	TMap<Worker_EntityId_Key, int32> EntitySlots;
+	TArray<FEntityRecord> EntityRecords;
+	TArray<int32> FreeEntitySlots;
+
+	// Indexed directly by component id.
+	TArray<int32> ColumnIndexByComponentId;
+	TArray<TUniquePtr<SpatialGDK::ComponentColumnBase>> Columns;
 };
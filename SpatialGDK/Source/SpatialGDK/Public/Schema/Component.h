@@ -14,33 +14,148 @@ struct Component
 	virtual void ApplyComponentUpdate(const Worker_ComponentUpdate& Update) {}
 };
 
-class ComponentStorageBase
+// Sparse set of the entities that have a given component, keyed by the entity's dense slot in USpatialStaticComponentView.
+// Authority is stored as two bit arrays indexed by entity slot, so authority checks are plain array reads.
+class ComponentColumnBase
 {
 public:
-	virtual ~ComponentStorageBase(){};
-	virtual TUniquePtr<ComponentStorageBase> Copy() const = 0;
+	virtual ~ComponentColumnBase() {}
+
+	bool Contains(int32 EntitySlot) const
+	{
+		return GetDenseIndex(EntitySlot) != INDEX_NONE;
+	}
+
+	int32 GetDenseIndex(int32 EntitySlot) const
+	{
+		return SlotToDense.IsValidIndex(EntitySlot) ? SlotToDense[EntitySlot] : INDEX_NONE;
+	}
+
+	int32 Num() const
+	{
+		return DenseToSlot.Num();
+	}
+
+	void Add(int32 EntitySlot, const Worker_ComponentData& Data)
+	{
+		const int32 ExistingIndex = GetDenseIndex(EntitySlot);
+		if (ExistingIndex != INDEX_NONE)
+		{
+			AssignData(ExistingIndex, Data);
+			return;
+		}
+
+		if (SlotToDense.Num() <= EntitySlot)
+		{
+			SlotToDense.Reserve(FMath::RoundUpToPowerOfTwo(EntitySlot + 1));
+			while (SlotToDense.Num() <= EntitySlot)
+			{
+				SlotToDense.Add(INDEX_NONE);
+			}
+		}
+
+		SlotToDense[EntitySlot] = DenseToSlot.Add(EntitySlot);
+		AddData(Data);
+	}
+
+	void Remove(int32 EntitySlot)
+	{
+		SetAuthority(EntitySlot, WORKER_AUTHORITY_NOT_AUTHORITATIVE);
+
+		const int32 DenseIndex = GetDenseIndex(EntitySlot);
+		if (DenseIndex == INDEX_NONE)
+		{
+			return;
+		}
+
+		// Swap the last element into the removed one to keep storage contiguous.
+		const int32 LastSlot = DenseToSlot.Last();
+		DenseToSlot.RemoveAtSwap(DenseIndex, 1, false);
+		RemoveDataAtSwap(DenseIndex);
+		if (LastSlot != EntitySlot)
+		{
+			SlotToDense[LastSlot] = DenseIndex;
+		}
+		SlotToDense[EntitySlot] = INDEX_NONE;
+	}
+
+	Worker_Authority GetAuthority(int32 EntitySlot) const
+	{
+		if (EntitySlot >= Authoritative.Num())
+		{
+			return WORKER_AUTHORITY_NOT_AUTHORITATIVE;
+		}
+
+		if (Authoritative[EntitySlot])
+		{
+			return WORKER_AUTHORITY_AUTHORITATIVE;
+		}
+
+		return AuthorityLossImminent[EntitySlot] ? WORKER_AUTHORITY_AUTHORITY_LOSS_IMMINENT : WORKER_AUTHORITY_NOT_AUTHORITATIVE;
+	}
+
+	void SetAuthority(int32 EntitySlot, Worker_Authority Authority)
+	{
+		if (EntitySlot >= Authoritative.Num())
+		{
+			if (Authority == WORKER_AUTHORITY_NOT_AUTHORITATIVE)
+			{
+				return;
+			}
+
+			const int32 NewNum = FMath::RoundUpToPowerOfTwo(EntitySlot + 1);
+			while (Authoritative.Num() < NewNum)
+			{
+				Authoritative.Add(false);
+				AuthorityLossImminent.Add(false);
+			}
+		}
+
+		Authoritative[EntitySlot] = Authority == WORKER_AUTHORITY_AUTHORITATIVE;
+		AuthorityLossImminent[EntitySlot] = Authority == WORKER_AUTHORITY_AUTHORITY_LOSS_IMMINENT;
+	}
+
+protected:
+	// Only hand written components keep their data. For the rest only presence and authority are tracked.
+	virtual void AddData(const Worker_ComponentData& Data) {}
+	virtual void AssignData(int32 DenseIndex, const Worker_ComponentData& Data) {}
+	virtual void RemoveDataAtSwap(int32 DenseIndex) {}
+
+private:
+	TArray<int32> SlotToDense;
+	TArray<int32> DenseToSlot;
+	TBitArray<> Authoritative;
+	TBitArray<> AuthorityLossImminent;
 };
 
 template <typename T>
-class ComponentStorage : public ComponentStorageBase
+class ComponentColumn : public ComponentColumnBase
 {
 public:
-	explicit ComponentStorage(const T& data) : data{data} {}
-	explicit ComponentStorage(T&& data) : data{MoveTemp(data)} {}
-	~ComponentStorage() override {}
+	T* Get(int32 EntitySlot)
+	{
+		const int32 DenseIndex = GetDenseIndex(EntitySlot);
+		return DenseIndex != INDEX_NONE ? &Data[DenseIndex] : nullptr;
+	}
+
+protected:
+	void AddData(const Worker_ComponentData& InData) override
+	{
+		Data.Emplace(InData);
+	}
 
-	TUniquePtr<ComponentStorageBase> Copy() const override
+	void AssignData(int32 DenseIndex, const Worker_ComponentData& InData) override
 	{
-		return TUniquePtr<ComponentStorageBase>{new ComponentStorage{data}};
+		Data[DenseIndex] = T(InData);
 	}
 
-	T& Get()
+	void RemoveDataAtSwap(int32 DenseIndex) override
 	{
-		return data;
+		Data.RemoveAtSwap(DenseIndex, 1, false);
 	}
 
 private:
-	T data;
+	TArray<T> Data;
 };
 
 } // namespace SpatialGDK
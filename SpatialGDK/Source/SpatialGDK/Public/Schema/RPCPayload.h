@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Schema/Component.h"
+#include "Serialization/BitWriter.h"
 #include "SpatialConstants.h"
 #include "Utils/SchemaUtils.h"
 
@@ -19,6 +20,15 @@ struct RPCPayload
 	RPCPayload(uint32 InOffset, uint32 InIndex, TArray<uint8>&& Data) : Offset(InOffset), Index(InIndex), PayloadData(MoveTemp(Data))
 	{}
 
+	// Takes the writer's buffer instead of copying it. The writer must not be used afterwards.
+	RPCPayload(uint32 InOffset, uint32 InIndex, FBitWriter&& Writer) : Offset(InOffset), Index(InIndex)
+	{
+		const int64 NumBytes = Writer.GetNumBytes();
+		// FBitWriter only hands out its buffer as const, taking it is safe as the writer is being discarded.
+		PayloadData = MoveTemp(*const_cast<TArray<uint8>*>(Writer.GetBuffer()));
+		PayloadData.SetNum(NumBytes, /* bAllowShrinking */ false);
+	}
+
 	RPCPayload(const Schema_Object* RPCObject)
 	{
 		Offset = Schema_GetUint32(RPCObject, SpatialConstants::UNREAL_RPC_PAYLOAD_OFFSET_ID);
@@ -43,6 +53,42 @@ struct RPCPayload
 	TArray<uint8> PayloadData;
 };
 
+// Non-owning view of an RPC payload, pointing either at an RPCPayload or straight at the bytes of the schema object an
+// RPC was received in, so RPCs that can be applied immediately are never copied out of the op. A view is only valid as
+// long as the memory it points to, so it must be turned into an RPCPayload before the RPC is queued.
+struct RPCPayloadView
+{
+	RPCPayloadView(const RPCPayload& Payload)
+		: Offset(Payload.Offset)
+		, Index(Payload.Index)
+		, Data(Payload.PayloadData.GetData())
+		, NumBytes(Payload.PayloadData.Num())
+	{}
+
+	explicit RPCPayloadView(const Schema_Object* RPCObject)
+	{
+		Offset = Schema_GetUint32(RPCObject, SpatialConstants::UNREAL_RPC_PAYLOAD_OFFSET_ID);
+		Index = Schema_GetUint32(RPCObject, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_INDEX_ID);
+		Data = Schema_GetBytes(RPCObject, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_PAYLOAD_ID);
+		NumBytes = Schema_GetBytesLength(RPCObject, SpatialConstants::UNREAL_RPC_PAYLOAD_RPC_PAYLOAD_ID);
+	}
+
+	int64 CountDataBits() const
+	{
+		return int64(NumBytes) * 8;
+	}
+
+	RPCPayload ToPayload() const
+	{
+		return RPCPayload(Offset, Index, TArray<uint8>(Data, NumBytes));
+	}
+
+	uint32 Offset;
+	uint32 Index;
+	const uint8* Data;
+	uint32 NumBytes;
+};
+
 struct RPCsOnEntityCreation : Component
 {
 	static const Worker_ComponentId ComponentId = SpatialConstants::RPCS_ON_ENTITY_CREATION_ID;
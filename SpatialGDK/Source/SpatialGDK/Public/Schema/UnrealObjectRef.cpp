@@ -2,5 +2,139 @@
 
 #include "Schema/UnrealObjectRef.h"
 
+#include "Misc/ScopeRWLock.h"
+
 const FUnrealObjectRef FUnrealObjectRef::NULL_OBJECT_REF = FUnrealObjectRef(0, 0);
 const FUnrealObjectRef FUnrealObjectRef::UNRESOLVED_OBJECT_REF = FUnrealObjectRef(0, 1);
+
+namespace
+{
+
+// Paths are compared case-sensitively, as they were before being interned.
+struct FPathIdKeyFuncs : BaseKeyFuncs<TPair<FString, uint32>, FString, /* bInAllowDuplicateKeys */ false>
+{
+	static FORCEINLINE const FString& GetSetKey(const TPair<FString, uint32>& Element) { return Element.Key; }
+	static FORCEINLINE bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+	static FORCEINLINE uint32 GetKeyHash(const FString& Key) { return GetTypeHash(Key); }
+};
+
+// Refs are built on the game thread and on the worker connection thread, so the tables are guarded by a lock. Entries are
+// never removed, and paths are allocated individually so that references to them stay valid as the table grows.
+// Ids are indices into the arrays plus one, leaving 0 for unset.
+struct FInternedObjectRefTables
+{
+	FRWLock Lock;
+
+	TArray<TUniquePtr<FString>> Paths;
+	TMap<FString, uint32, FDefaultSetAllocator, FPathIdKeyFuncs> PathIds;
+
+	TArray<FUnrealObjectRef> Outers;
+	TMap<FUnrealObjectRef, uint32> OuterIds;
+
+	static FInternedObjectRefTables& Get()
+	{
+		static FInternedObjectRefTables Tables;
+		return Tables;
+	}
+};
+
+} // anonymous namespace
+
+FUnrealObjectRef FUnrealObjectRef::GetLevelReference() const
+{
+	static const uint32 PersistentLevelPathId = InternPath(TEXT("PersistentLevel"));
+
+	if (PathId == PersistentLevelPathId)
+	{
+		return *this;
+	}
+
+	if (HasOuter())
+	{
+		return GetOuter().GetLevelReference();
+	}
+	else
+	{
+		return FUnrealObjectRef{};
+	}
+}
+
+const FString& FUnrealObjectRef::GetPath() const
+{
+	checkf(HasPath(), TEXT("It is an error to call GetPath() on an object ref without a path. Please check HasPath()."));
+
+	FInternedObjectRefTables& Tables = FInternedObjectRefTables::Get();
+	FRWScopeLock ReadLock(Tables.Lock, SLT_ReadOnly);
+	return *Tables.Paths[PathId - 1];
+}
+
+FUnrealObjectRef FUnrealObjectRef::GetOuter() const
+{
+	checkf(HasOuter(), TEXT("It is an error to call GetOuter() on an object ref without an outer. Please check HasOuter()."));
+
+	FUnrealObjectRef Outer;
+	{
+		FInternedObjectRefTables& Tables = FInternedObjectRefTables::Get();
+		FRWScopeLock ReadLock(Tables.Lock, SLT_ReadOnly);
+		Outer = Tables.Outers[OuterId - 1];
+	}
+
+	// The interned outer has the flag of whichever ref interned it first.
+	Outer.bNoLoadOnClient = bOuterNoLoadOnClient;
+	return Outer;
+}
+
+uint32 FUnrealObjectRef::InternPath(const FString& Path)
+{
+	FInternedObjectRefTables& Tables = FInternedObjectRefTables::Get();
+
+	{
+		FRWScopeLock ReadLock(Tables.Lock, SLT_ReadOnly);
+		if (const uint32* Id = Tables.PathIds.Find(Path))
+		{
+			return *Id;
+		}
+	}
+
+	FRWScopeLock WriteLock(Tables.Lock, SLT_Write);
+	if (const uint32* Id = Tables.PathIds.Find(Path))
+	{
+		return *Id;
+	}
+
+	Tables.Paths.Add(MakeUnique<FString>(Path));
+	const uint32 Id = Tables.Paths.Num();
+	Tables.PathIds.Add(Path, Id);
+	return Id;
+}
+
+uint32 FUnrealObjectRef::InternOuter(const FUnrealObjectRef& Outer)
+{
+	FInternedObjectRefTables& Tables = FInternedObjectRefTables::Get();
+
+	{
+		FRWScopeLock ReadLock(Tables.Lock, SLT_ReadOnly);
+		if (const uint32* Id = Tables.OuterIds.Find(Outer))
+		{
+			return *Id;
+		}
+	}
+
+	FRWScopeLock WriteLock(Tables.Lock, SLT_Write);
+	if (const uint32* Id = Tables.OuterIds.Find(Outer))
+	{
+		return *Id;
+	}
+
+	Tables.Outers.Add(Outer);
+	const uint32 Id = Tables.Outers.Num();
+	Tables.OuterIds.Add(Outer, Id);
+	return Id;
+}
+
+TArray<FUnrealObjectRef> FUnrealObjectRef::GetInternedOuters()
+{
+	FInternedObjectRefTables& Tables = FInternedObjectRefTables::Get();
+	FRWScopeLock ReadLock(Tables.Lock, SLT_ReadOnly);
+	return Tables.Outers;
+}
@@ -9,7 +9,16 @@
 
 using Worker_EntityId = std::int64_t;
 
-struct FUnrealObjectRef
+// Refers to a replicated object by the entity it belongs to and its offset in that entity, or to a stably named
+// object by its path and outer.
+//
+// Paths and outers are interned into process-wide tables the first time they are seen and only their ids are stored,
+// so refs are small PODs that are copied without allocating, and hashed and compared without touching any strings.
+//
+// As before interning, bNoLoadOnClient is not part of a ref's identity, and neither is its outer's: outers are interned
+// by entity, offset, path and outer only. The outer's flag is kept in the ref, so GetOuter still returns the flag the
+// ref was built with, which resolving the outer on a client depends on.
+struct SPATIALGDK_API FUnrealObjectRef
 {
 	FUnrealObjectRef() = default;
 
@@ -18,60 +27,54 @@ struct FUnrealObjectRef
 		, Offset(Offset)
 	{}
 
-	FUnrealObjectRef(Worker_EntityId Entity, uint32 Offset, FString Path, FUnrealObjectRef Outer, bool bNoLoadOnClient = false)
+	FUnrealObjectRef(Worker_EntityId Entity, uint32 Offset, const FString& Path, const FUnrealObjectRef& Outer, bool bNoLoadOnClient = false)
 		: Entity(Entity)
 		, Offset(Offset)
-		, Path(Path)
-		, Outer(Outer)
+		, PathId(InternPath(Path))
+		, OuterId(InternOuter(Outer))
 		, bNoLoadOnClient(bNoLoadOnClient)
+		, bOuterNoLoadOnClient(Outer.bNoLoadOnClient)
 	{}
 
-	FUnrealObjectRef(const FUnrealObjectRef& In)
-		: Entity(In.Entity)
-		, Offset(In.Offset)
-		, Path(In.Path)
-		, Outer(In.Outer)
-		, bNoLoadOnClient(In.bNoLoadOnClient)
-	{}
+	FORCEINLINE FString ToString() const
+	{
+		return FString::Printf(TEXT("(entity ID: %lld, offset: %u)"), Entity, Offset);
+	}
 
-	FORCEINLINE FUnrealObjectRef& operator=(const FUnrealObjectRef& In)
+	FUnrealObjectRef GetLevelReference() const;
+
+	FORCEINLINE bool HasPath() const
 	{
-		Entity = In.Entity;
-		Offset = In.Offset;
-		Path = In.Path;
-		Outer = In.Outer;
-		bNoLoadOnClient = In.bNoLoadOnClient;
-		return *this;
+		return PathId != INVALID_ID;
 	}
 
-	FORCEINLINE FString ToString() const
+	// The returned string lives as long as the process.
+	const FString& GetPath() const;
+
+	void SetPath(const FString& Path)
 	{
-		return FString::Printf(TEXT("(entity ID: %lld, offset: %u)"), Entity, Offset);
+		PathId = InternPath(Path);
 	}
 
-	FORCEINLINE FUnrealObjectRef GetLevelReference() const
+	FORCEINLINE bool HasOuter() const
 	{
-		if (Path->Equals(TEXT("PersistentLevel")))
-		{
-			return *this;
-		}
-
-		if (Outer.IsSet())
-		{
-			return Outer->GetLevelReference();
-		}
-		else
-		{
-			return FUnrealObjectRef{};
-		}
+		return OuterId != INVALID_ID;
+	}
+
+	FUnrealObjectRef GetOuter() const;
+
+	void SetOuter(const FUnrealObjectRef& Outer)
+	{
+		OuterId = InternOuter(Outer);
+		bOuterNoLoadOnClient = Outer.bNoLoadOnClient;
 	}
 
 	FORCEINLINE bool operator==(const FUnrealObjectRef& Other) const
 	{
 		return Entity == Other.Entity &&
 			Offset == Other.Offset &&
-			((!Path && !Other.Path) || (Path && Other.Path && Path->Equals(*Other.Path))) &&
-			((!Outer && !Other.Outer) || (Outer && Other.Outer && *Outer == *Other.Outer));
+			PathId == Other.PathId &&
+			OuterId == Other.OuterId;
 		// Intentionally don't compare bNoLoadOnClient since it does not affect equality.
 	}
 
@@ -88,11 +91,23 @@ struct FUnrealObjectRef
 	static const FUnrealObjectRef NULL_OBJECT_REF;
 	static const FUnrealObjectRef UNRESOLVED_OBJECT_REF;
 
-	Worker_EntityId Entity;
-	uint32 Offset;
-	SpatialGDK::TSchemaOption<FString> Path;
-	SpatialGDK::TSchemaOption<FUnrealObjectRef> Outer;
+	// Copies of every outer interned so far, i.e. refs of objects that other refs have been built with.
+	static TArray<FUnrealObjectRef> GetInternedOuters();
+
+	Worker_EntityId Entity = 0;
+	uint32 Offset = 0;
+	uint32 PathId = INVALID_ID;
+	uint32 OuterId = INVALID_ID;
 	bool bNoLoadOnClient = false;
+
+private:
+	static constexpr uint32 INVALID_ID = 0;
+
+	// Interned outers don't keep the flag of the ref they were built from, see GetOuter.
+	bool bOuterNoLoadOnClient = false;
+
+	static uint32 InternPath(const FString& Path);
+	static uint32 InternOuter(const FUnrealObjectRef& Outer);
 };
 
 inline uint32 GetTypeHash(const FUnrealObjectRef& ObjectRef)
@@ -100,8 +115,8 @@ inline uint32 GetTypeHash(const FUnrealObjectRef& ObjectRef)
 	uint32 Result = 1327u;
 	Result = (Result * 977u) + GetTypeHash(static_cast<int64>(ObjectRef.Entity));
 	Result = (Result * 977u) + GetTypeHash(ObjectRef.Offset);
-	Result = (Result * 977u) + GetTypeHash(ObjectRef.Path);
-	Result = (Result * 977u) + GetTypeHash(ObjectRef.Outer);
+	Result = (Result * 977u) + ObjectRef.PathId;
+	Result = (Result * 977u) + ObjectRef.OuterId;
 	// Intentionally don't hash bNoLoadOnClient.
 	return Result;
 }
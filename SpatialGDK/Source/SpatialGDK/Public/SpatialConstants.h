@@ -114,6 +114,7 @@ namespace SpatialConstants
 	const Worker_ComponentId RPCS_ON_ENTITY_CREATION_ID						= 9985;
 	const Worker_ComponentId DEBUG_METRICS_COMPONENT_ID						= 9984;
 	const Worker_ComponentId ALWAYS_RELEVANT_COMPONENT_ID					= 9983;
+	const Worker_ComponentId POSITION_STREAM_COMPONENT_ID					= 9982;
 
 	const Worker_ComponentId STARTING_GENERATED_COMPONENT_ID				= 10000;
 
@@ -135,6 +136,9 @@ namespace SpatialConstants
 
 	const Schema_FieldId CLEAR_RPCS_ON_ENTITY_CREATION						= 1;
 
+	const Schema_FieldId POSITION_STREAM_CELL_SIZE_ID						= 1;
+	const Schema_FieldId POSITION_STREAM_POSITIONS_ID						= 2;
+
 	// DebugMetrics command IDs
 	const Schema_FieldId DEBUG_METRICS_START_RPC_METRICS_ID					= 1;
 	const Schema_FieldId DEBUG_METRICS_STOP_RPC_METRICS_ID					= 2;
@@ -197,6 +201,8 @@ namespace SpatialConstants
 	const Worker_ComponentId MAX_EXTERNAL_SCHEMA_ID = 2000;
 
 	const FString SPATIALOS_METRICS_DYNAMIC_FPS = TEXT("Dynamic.FPS");
+	const FString SPATIALOS_METRICS_COMPONENT_UPDATES_QUEUED = TEXT("ComponentUpdates.Queued");
+	const FString SPATIALOS_METRICS_COMPONENT_UPDATES_SENT = TEXT("ComponentUpdates.Sent");
 
 	const FString LOCATOR_HOST = TEXT("locator.improbable.io");
 	const uint16 LOCATOR_PORT = 444;
@@ -43,6 +43,17 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Entity Pool", meta = (ConfigRestartRequired = false, DisplayName = "Refresh Count"))
 	uint32 EntityPoolRefreshCount;
 
+	/**
+	 * When above 0, the entity pool tracks how fast entity IDs are used and keeps enough entity IDs for this many seconds
+	 * of use on top of `Pool Refresh Threshold`, reserving larger batches while Actors are being spawned quickly.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Entity Pool", meta = (ConfigRestartRequired = false, DisplayName = "Reservation Lead Time (seconds)"))
+	float EntityPoolReservationLeadTimeSeconds;
+
+	/** The number of entity ID reservation requests that can be in flight at the same time. */
+	UPROPERTY(EditAnywhere, config, Category = "Entity Pool", meta = (ConfigRestartRequired = false, DisplayName = "Max Pending Reservations", ClampMin = "1"))
+	uint32 EntityPoolMaxPendingReservations;
+
 	/** Specifies the amount of time, in seconds, between heartbeat events sent from a game client to notify the server-worker instances that it's connected. */
 	UPROPERTY(EditAnywhere, config, Category = "Heartbeat", meta = (ConfigRestartRequired = false, DisplayName = "Heartbeat Interval (seconds)"))
 	float HeartbeatIntervalSeconds;
@@ -63,6 +74,15 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, DisplayName = "Maximum Actors replicated per tick"))
 	uint32 ActorReplicationRateLimit;
 
+	/**
+	* Maximum serialized size, in bytes, of the property updates a server-worker instance sends per tick. Once it is spent, the remaining
+	* Actors are replicated on a later tick, and the priority they accumulate while waiting makes sure they eventually are.
+	* Entity creation is limited separately. The last Actor replicated in a tick can go over the budget.
+	* Default: `0` (no limit)
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, DisplayName = "Maximum replication bytes per tick"))
+	uint32 ReplicationBytesPerTick;
+
 	/** 
 	* Specifies the maximum number of entities created by the SpatialOS Runtime per tick. 
 	* (The SpatialOS Runtime handles entity creation separately from Actor replication to ensure it can handle entity creation requests under load.)
@@ -72,13 +92,60 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, DisplayName = "Maximum entities created per tick"))
 	uint32 EntityCreationRateLimit;
 
+	/**
+	* Specifies the maximum number of create entity requests sent per second. Requests over the budget are queued and sent on later ticks,
+	* entities owned by players first, then entities relevant to a viewer, then everything else.
+	* Default: `0` per second (no limit, requests are sent as soon as the Actor is first replicated)
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, DisplayName = "Maximum entities created per second"))
+	uint32 EntityCreationRequestsPerSecond;
+
+	/**
+	* Specifies the maximum number of bytes of component data sent in create entity requests per second, queuing requests in the same way as `Maximum entities created per second`.
+	* Default: `0` bytes per second (no limit)
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, DisplayName = "Maximum entity creation bytes per second"))
+	uint32 EntityCreationBytesPerSecond;
+
 	/**
 	* Specifies the rate, in number of times per second, at which server-worker instance updates are sent to and received from the SpatialOS Runtime.
+	* Not used when `Wake SpatialOS Network Thread On Demand` is enabled.
 	* Default:1000/s
 	*/
 	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, DisplayName = "SpatialOS Network Update Rate"))
 	float OpsUpdateRate;
 
+	/**
+	* When enabled, the SpatialOS network thread waits on the connection for incoming ops, for up to `Get Op List Timeout`, instead of sleeping
+	* for a fixed interval every update, so it wakes up as soon as ops arrive and stays idle when there is no traffic.
+	* `SpatialOS Network Update Rate` is not used in this mode.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = true, DisplayName = "Wake SpatialOS Network Thread On Demand"))
+	bool bWakeOpsThreadOnDemand;
+
+	/**
+	* Maximum time, in milliseconds, the SpatialOS network thread waits on the connection for incoming ops when there is nothing to send,
+	* when `Wake SpatialOS Network Thread On Demand` is enabled. The wait can't be interrupted, so outgoing messages queued during it are sent
+	* when ops arrive or the timeout passes. Lowering it reduces that latency on idle connections at the cost of waking the thread more often.
+	* Default: `33` ms (one server tick at 30 ticks per second)
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = true, EditCondition = "bWakeOpsThreadOnDemand", DisplayName = "Get Op List Timeout (ms)"))
+	uint32 OpListTimeoutMs;
+
+	/**
+	* Number of outgoing messages that can be queued for the SpatialOS network thread without allocating (rounded up to a power of two).
+	* Messages queued beyond this spill into a slower overflow queue; the high-water mark is reported under `stat SpatialNet`.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = true, DisplayName = "Outgoing Message Queue Capacity"))
+	uint32 OutgoingMessageQueueCapacity;
+
+	/**
+	* Decode component updates for Position, EntityAcl, RPC endpoint and Heartbeat components on the SpatialOS network thread,
+	* so the game thread only applies already-parsed data when processing ops.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = true, DisplayName = "Decode Component Updates On Network Thread"))
+	bool bPreDecodeComponentUpdates;
+
 	/** Replicate handover properties between servers, required for zoned worker deployments.*/
 	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false))
 	bool bEnableHandover;
@@ -87,6 +154,53 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false))
 	float MaxNetCullDistanceSquared;
 
+	/** Prioritize Actors for replication using a spatial grid, so each Actor is only weighed against the viewers within its NetCullDistanceSquared instead of against every viewer. */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, DisplayName = "Use Relevancy Grid"))
+	bool bUseRelevancyGrid;
+
+	/** Size, in centimeters, of the cells of the relevancy grid. */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = true, EditCondition = "bUseRelevancyGrid", ClampMin = "100.0"))
+	float RelevancyGridCellSize;
+
+	/**
+	* Compare replicated properties of the Actors replicated each frame on worker threads, before replicating them on the game thread.
+	* Component updates are still created and sent on the game thread, in priority order.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, DisplayName = "Compare Replicated Properties In Parallel"))
+	bool bParallelPropertyComparison;
+
+	/** Seconds an unreliable RPC can stay queued, waiting for its target or parameters to be resolved, before it is dropped. 0 keeps queued unreliable RPCs until they can be processed. */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, ClampMin = "0.0", DisplayName = "Queued Unreliable RPC Time To Live (seconds)"))
+	float QueuedUnreliableRPCTimeToLive;
+
+	/** Maximum number of unreliable RPCs of each type that can be queued for an entity. Queuing one more drops the oldest. 0 means no limit. */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, DisplayName = "Maximum Queued Unreliable RPCs Per Entity"))
+	uint32 MaxQueuedUnreliableRPCsPerEntity;
+
+	/**
+	* Load every class in the SchemaDatabase and build its class info when the net driver starts, instead of on first use, so replicating
+	* a class for the first time in a live match doesn't cause a hitch. All replicated classes stay loaded for as long as the net driver.
+	* Regenerate schema after changing the RPCs of a class to keep its prebuilt data up to date.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = true, DisplayName = "Prebuild Class Info At Startup"))
+	bool bPrebuildClassInfo;
+
+	/** Build the class info of the loaded classes on a worker thread when prebuilding it. Using class info before it is built waits for it. */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = true, EditCondition = "bPrebuildClassInfo", DisplayName = "Prebuild Class Info In Background"))
+	bool bPrebuildClassInfoInBackground;
+
+	/**
+	* Only replicate Actors that have been marked dirty with SpatialGDK::MarkDirtyForReplication since they were last replicated, or that moved.
+	* Clean Actors are skipped before their properties are compared and don't count towards the Actor replication rate limit.
+	* Gameplay code must mark an Actor dirty whenever it changes a replicated property, or adds or removes a replicated subobject, of the Actor or its subobjects.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, DisplayName = "Use Dirty Actor Replication"))
+	bool bUseDirtyActorReplication;
+
+	/** Actor classes that use dirty Actor replication. Children of these classes are also included. If empty, no Actors use it. Player controllers never use it. */
+	UPROPERTY(EditAnywhere, config, Category = "Replication", meta = (ConfigRestartRequired = false, EditCondition = "bUseDirtyActorReplication", DisplayName = "Dirty Actor Replication Classes"))
+	TArray<TSoftClassPtr<AActor>> DirtyActorReplicationClasses;
+
 	/** Query Based Interest is required for level streaming and the AlwaysInterested UPROPERTY specifier to be supported when using spatial networking, however comes at a performance cost for larger-scale projects.*/
 	UPROPERTY(config, meta = (ConfigRestartRequired = false))
 	bool bUsingQBI;
@@ -99,6 +213,46 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "SpatialOS Position Updates", meta = (ConfigRestartRequired = false))
 	float PositionDistanceThreshold;
 
+	/**
+	* Send the Position updates of a server-worker's Actors as quantized positions packed into one PositionStream update on its worker entity,
+	* which other server-workers decode into their view of Position. The SpatialOS Position itself, used by the Runtime for load balancing
+	* and interest, is only updated at PositionStreamPositionUpdateFrequency.
+	* Every server-worker receives the full stream of every other server-worker, regardless of its interest, so the bandwidth between
+	* server-workers grows with the number of server-workers times the number of moving Actors.
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "SpatialOS Position Updates", meta = (ConfigRestartRequired = true, DisplayName = "Use Position Stream"))
+	bool bUsePositionStream;
+
+	/** Size, in centimeters, of the grid cells positions are quantized in. Positions are precise to the cell size divided by 65535. */
+	UPROPERTY(EditAnywhere, config, Category = "SpatialOS Position Updates", meta = (ConfigRestartRequired = true, EditCondition = "bUsePositionStream", ClampMin = "100.0"))
+	float PositionStreamCellSize;
+
+	/** Frequency for updating an Actor's SpatialOS Position when using the position stream. */
+	UPROPERTY(EditAnywhere, config, Category = "SpatialOS Position Updates", meta = (ConfigRestartRequired = false, EditCondition = "bUsePositionStream", ClampMin = "0.01"))
+	float PositionStreamPositionUpdateFrequency;
+
+	/**
+	* Number of entities read from a snapshot at a time when loading it. Ids are reserved for a chunk at once, and the next chunk is read
+	* in the background while the entities of the previous one are created, so about two chunks are held in memory.
+	* Default: `1000` entities
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Snapshots", meta = (ConfigRestartRequired = false, ClampMin = "1", DisplayName = "Snapshot load chunk size"))
+	uint32 SnapshotLoadChunkSize;
+
+	/**
+	* Specifies the maximum number of create entity requests sent per second when loading a snapshot.
+	* Default: `0` per second (no limit)
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Snapshots", meta = (ConfigRestartRequired = false, DisplayName = "Maximum snapshot entities created per second"))
+	uint32 SnapshotLoadEntitiesPerSecond;
+
+	/**
+	* Specifies the maximum number of delete entity requests waiting for a response when wiping the world before a server travel.
+	* Default: `1000` requests
+	*/
+	UPROPERTY(EditAnywhere, config, Category = "Snapshots", meta = (ConfigRestartRequired = false, ClampMin = "1", DisplayName = "Maximum world wipe deletes in flight"))
+	uint32 WorldWipeMaxDeletesInFlight;
+
 	/** Metrics about client and server performance can be reported to SpatialOS to monitor a deployments health.*/
 	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (ConfigRestartRequired = false))
 	bool bEnableMetrics;
@@ -140,6 +294,10 @@ public:
 	UPROPERTY(config, meta = (ConfigRestartRequired = false))
 	bool bPackRPCs;
 
+	/** Merge component updates sent to the same entity and component during a frame into a single update, sent at the end of the frame. */
+	UPROPERTY(config, meta = (ConfigRestartRequired = true))
+	bool bCoalesceComponentUpdates;
+
 	/** The receptionist host to use if no 'receptionistHost' argument is passed to the command line. */
 	UPROPERTY(EditAnywhere, config, Category = "Local Connection", meta = (ConfigRestartRequired = false))
 	FString DefaultReceptionistHost;
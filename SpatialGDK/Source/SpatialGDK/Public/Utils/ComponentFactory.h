@@ -25,6 +25,8 @@ using FUnresolvedObjectsMap = TMap<Schema_FieldId, FUnresolvedObjectsSet>;
 namespace SpatialGDK
 {
 
+class FSchemaScratch;
+
 class SPATIALGDK_API ComponentFactory
 {
 public:
@@ -57,6 +59,7 @@ private:
 	USpatialNetDriver* NetDriver;
 	USpatialPackageMapClient* PackageMap;
 	USpatialClassInfoManager* ClassInfoManager;
+	FSchemaScratch& Scratch;
 
 	FUnresolvedObjectsMap& PendingRepUnresolvedObjectsMap;
 	FUnresolvedObjectsMap& PendingHandoverUnresolvedObjectsMap;
@@ -0,0 +1,67 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "SpatialCommonTypes.h"
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+class USpatialWorkerConnection;
+
+// Collects the component updates generated during a frame and merges updates to the same (entity, component) pair,
+// so that each pair is sent at most once per flush. Fields are last-writer-wins and events are concatenated.
+// Updates to an entity are sent in the order they were queued: an update is only merged into the entity's most recently
+// queued pending update, otherwise the entity's pending updates are sent first.
+class FComponentUpdateCoalescer
+{
+public:
+	~FComponentUpdateCoalescer();
+
+	void Init(USpatialWorkerConnection* InConnection);
+
+	// Takes ownership of the update's schema data.
+	void QueueUpdate(Worker_EntityId EntityId, Worker_ComponentUpdate& Update);
+
+	// Sends any updates queued for an entity, e.g. before a message that must not overtake them.
+	void FlushUpdatesForEntity(Worker_EntityId EntityId);
+
+	// Destroys any updates queued for an entity, e.g. when it is being deleted.
+	void DiscardUpdatesForEntity(Worker_EntityId EntityId);
+
+	// Destroys any updates queued for a component, e.g. when it is being removed.
+	void DiscardUpdatesForComponent(Worker_EntityId EntityId, Worker_ComponentId ComponentId);
+
+	void Flush();
+
+	// Number of updates passed to QueueUpdate and number of updates actually sent since the last call.
+	void ConsumeCounts(uint32& OutQueuedCount, uint32& OutSentCount);
+
+	// Merges a newer update into an older one for the same component. Target's schema data may be replaced.
+	static void MergeComponentUpdate(Schema_ComponentUpdate* Source, Worker_ComponentUpdate& Target);
+
+private:
+	using FEntityComponent = TPair<Worker_EntityId_Key, Worker_ComponentId>;
+
+	struct FPendingUpdate
+	{
+		Worker_EntityId EntityId;
+		Worker_ComponentUpdate Update;
+	};
+
+	// Removes the pending updates matching Predicate, in order, sending them if bSend is set and destroying them otherwise.
+	template <typename PredicateType>
+	void RemoveUpdates(PredicateType Predicate, bool bSend);
+
+	USpatialWorkerConnection* Connection = nullptr;
+
+	TArray<FPendingUpdate> PendingUpdates;
+	TMap<FEntityComponent, int32> PendingUpdateIndices;
+	// Index of the most recently queued pending update of each entity.
+	TMap<Worker_EntityId_Key, int32> LastPendingUpdateIndices;
+
+	uint32 QueuedCount = 0;
+	uint32 SentCount = 0;
+};
@@ -0,0 +1,68 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+class USpatialActorChannel;
+
+enum class EEntityCreationPriority : uint8
+{
+	PlayerOwned,
+	RelevantToViewer,
+	Other,
+	Count
+};
+
+// Holds create entity requests that have been built but not sent yet, and sends them in priority order while staying
+// within a budget of entities and bytes per second. Requests of the same priority are sent in the order they were queued.
+//
+// The budget accumulates between flushes up to a fraction of a second's worth, so that the requests queued by a level
+// load are spread over the following ticks instead of being sent in the same frame. A request that is bigger than the
+// remaining byte budget is still sent if any budget is left, and the overdraft is paid back by the following flushes.
+class FEntityCreationScheduler
+{
+public:
+	using FSendRequestFunction = TFunctionRef<void(USpatialActorChannel*, TArray<Worker_ComponentData>&&)>;
+
+	~FEntityCreationScheduler();
+
+	// A budget of 0 means no limit. With no limit on either, nothing needs to be queued.
+	void SetBudget(uint32 InEntitiesPerSecond, uint32 InBytesPerSecond);
+	bool IsLimited() const { return EntitiesPerSecond > 0 || BytesPerSecond > 0; }
+
+	// Takes ownership of the component data.
+	void QueueRequest(USpatialActorChannel* Channel, TArray<Worker_ComponentData>&& ComponentDatas, EEntityCreationPriority Priority);
+
+	// Sends as many queued requests as the budget allows. Requests whose channel was closed while they were queued are
+	// destroyed without being sent, since the entity would be deleted again as soon as it is created.
+	void Flush(double Now, FSendRequestFunction SendRequest);
+
+	int32 Num() const;
+
+private:
+	struct FPendingRequest
+	{
+		TWeakObjectPtr<USpatialActorChannel> Channel;
+		TArray<Worker_ComponentData> ComponentDatas;
+		uint32 Size;
+		double QueuedTime;
+	};
+
+	static void DestroyComponentDatas(TArray<Worker_ComponentData>& ComponentDatas);
+
+	bool HasBudget() const;
+	void AccumulateBudget(double Now);
+
+	TArray<FPendingRequest> PendingRequests[static_cast<uint8>(EEntityCreationPriority::Count)];
+
+	uint32 EntitiesPerSecond = 0;
+	uint32 BytesPerSecond = 0;
+
+	double EntityBudget = 0.0;
+	double ByteBudget = 0.0;
+	double LastFlushTime = 0.0;
+};
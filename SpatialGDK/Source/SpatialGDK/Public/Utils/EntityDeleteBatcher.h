@@ -0,0 +1,37 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+// Deletes a list of entities while keeping at most a fixed number of delete requests waiting for a response, so that deleting
+// every entity in a large world doesn't queue all of the requests on the connection at once. Every response has to be reported
+// with OnDeleteResponse, which frees up room for the next requests.
+class FEntityDeleteBatcher
+{
+public:
+	using FSendDeleteFunction = TFunctionRef<void(Worker_EntityId)>;
+
+	FEntityDeleteBatcher(TArray<Worker_EntityId>&& InEntityIds, int32 InMaxInFlight);
+
+	// Sends requests until the limit of requests in flight is reached or every entity has been sent.
+	void SendRequests(FSendDeleteFunction SendDelete);
+	void OnDeleteResponse(bool bSucceeded);
+
+	bool IsDone() const { return NumResponses == EntityIds.Num(); }
+
+	int32 Num() const { return EntityIds.Num(); }
+	int32 GetNumDeleted() const { return NumResponses - NumFailed; }
+	int32 GetNumFailed() const { return NumFailed; }
+	int32 GetNumInFlight() const { return NumSent - NumResponses; }
+
+private:
+	TArray<Worker_EntityId> EntityIds;
+	int32 MaxInFlight;
+
+	int32 NumSent = 0;
+	int32 NumResponses = 0;
+	int32 NumFailed = 0;
+};
@@ -42,6 +42,10 @@ public:
 
 private:
 	void OnEntityRangeExpired(uint32 ExpiringEntityRangeId);
+	void ReserveEntityIDsIfNeeded(double Now);
+
+	void UpdateAllocationRate(double Now);
+	double GetAllocationRate(double Now) const;
 
 	UPROPERTY()
 	USpatialNetDriver* NetDriver;
@@ -53,7 +57,19 @@ private:
 	TArray<EntityRange> ReservedEntityIDRanges;
 
 	bool bIsReady;
-	bool bIsAwaitingResponse;
 
 	uint32 NextEntityRangeId;
+
+	// Running totals of the IDs left in ReservedEntityIDRanges and of the IDs requested by reservations in flight.
+	int64 NumAvailableEntityIds = 0;
+	int64 NumReservingEntityIds = 0;
+	uint32 NumPendingReservations = 0;
+
+	// Smoothed number of IDs requested per second, sampled over AllocationRateSampleSeconds.
+	double AllocationRate = 0.0;
+	double RateSampleStartTime = 0.0;
+	uint32 AllocationsInSample = 0;
+
+	// Set while the pool has no IDs left, to track the time spent empty.
+	double EmptySinceTime = 0.0;
 };
@@ -0,0 +1,40 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USpatialNetConnection;
+
+// Tracks when each client connection a server-worker is authoritative over last sent a heartbeat, and detects timed out
+// connections in batches. Recording a heartbeat only writes a timestamp, and the timestamps are kept in one array that is
+// scanned at most once per scan interval, instead of re-arming a timer per connection on every heartbeat.
+// Timeouts are therefore detected up to one scan interval late.
+class SPATIALGDK_API FHeartbeatTracker
+{
+public:
+	using FOnTimedOut = TFunctionRef<void(USpatialNetConnection*)>;
+
+	// Returns the slot to pass to RecordHeartbeat and Remove.
+	int32 Add(USpatialNetConnection* Connection, double Now);
+
+	// The connection is checked against the slot, so a slot that was freed and reused by another connection is left alone.
+	void RecordHeartbeat(int32 Slot, const USpatialNetConnection* Connection, double Now);
+	void Remove(int32 Slot, const USpatialNetConnection* Connection);
+
+	// Removes the connections that haven't sent a heartbeat for TimeoutSeconds, then calls OnTimedOut for each of them.
+	void Tick(double Now, double TimeoutSeconds, FOnTimedOut OnTimedOut);
+
+	int32 Num() const { return Connections.Num() - FreeSlots.Num(); }
+
+	static constexpr double ScanIntervalSeconds = 1.0;
+
+private:
+	bool IsSlotFor(int32 Slot, const USpatialNetConnection* Connection) const;
+
+	TArray<double> LastHeartbeatTimes;
+	TArray<TWeakObjectPtr<USpatialNetConnection>> Connections;
+	TArray<int32> FreeSlots;
+
+	double LastScanTime = 0.0;
+};
@@ -0,0 +1,45 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "SpatialCommonTypes.h"
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+#include <WorkerSDK/improbable/c_worker.h>
+
+// Packs the positions of the entities a server-worker moved into a single PositionStream component update on its worker entity,
+// instead of sending one Position update per entity.
+//
+// Each position is stored as the grid cell it is in and its offset in that cell, quantized to 16 bits per axis. Entries are
+// sorted by entity id and written as the varint delta from the previous entity id, the zigzag varint cell coordinates, and the
+// three little-endian 16 bit offsets, so a moving entity usually takes around 10 bytes instead of a full Position update.
+// Only entity ids are delta-encoded. Positions are written in full, since a worker that starts seeing the stream later, or
+// misses an update, has no previous position to apply a delta to.
+class FPositionStream
+{
+public:
+	explicit FPositionStream(float InCellSize = 10000.0f);
+
+	void SetCellSize(float InCellSize) { CellSize = InCellSize; }
+
+	// Adding the same entity again replaces its position.
+	void Add(Worker_EntityId EntityId, const FVector& Location);
+
+	bool IsEmpty() const { return Positions.Num() == 0; }
+	int32 Num() const { return Positions.Num(); }
+
+	// Creates the update holding every position added since the last call, and clears them.
+	Worker_ComponentUpdate CreateUpdate();
+
+	static Worker_ComponentData CreateEmptyData(float CellSize);
+
+	// Calls Visitor with the entity id and dequantized location of every position in the fields of a PositionStream update or data.
+	static void Read(Schema_Object* ComponentObject, TFunctionRef<void(Worker_EntityId, const FVector&)> Visitor);
+
+private:
+	float CellSize;
+	TMap<Worker_EntityId_Key, FVector> Positions;
+	TArray<uint8> Buffer;
+};
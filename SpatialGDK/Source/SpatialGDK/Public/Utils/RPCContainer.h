@@ -10,7 +10,19 @@
 
 struct FPendingRPCParams;
 using FPendingRPCParamsPtr = TUniquePtr<FPendingRPCParams>;
-DECLARE_DELEGATE_RetVal_OneParam(bool, FProcessRPCDelegate, const FPendingRPCParams&)
+
+enum class EProcessRPCResult : uint8
+{
+	Processed,
+	// The RPC can't be processed yet. It is retried the next time the queues are processed.
+	Retry,
+	// The RPC's target object isn't resolved yet. Its entity's queue is skipped until UnblockEntity is called for it.
+	TargetUnresolved,
+	// The RPC can never be processed, e.g. because its target was destroyed, and is removed from the queue.
+	Drop
+};
+
+DECLARE_DELEGATE_RetVal_OneParam(EProcessRPCResult, FProcessRPCDelegate, const FPendingRPCParams&)
 
 struct FPendingRPCParams
 {
@@ -20,22 +32,64 @@ struct FPendingRPCParams
 	int ReliableRPCIndex;
 	FUnrealObjectRef ObjectRef;
 	SpatialGDK::RPCPayload Payload;
+
+	// Set when the RPC is queued, used to expire it.
+	double QueuedTime = 0.0;
 };
 
+// Queues of RPCs that couldn't be processed straight away, one FIFO per RPC type and entity so that RPCs of the same
+// type to the same entity are processed in order.
+//
+// Queues of entities whose target object isn't resolved yet are kept aside and not retried until UnblockEntity is
+// called for the entity, so that a large number of entities waiting to be checked out doesn't make every call to
+// ProcessRPCs expensive. Queues of a type can also be given a time to live and a maximum depth, after which their
+// oldest RPCs are dropped, which should only be used for unreliable RPCs. The time to live applies to blocked queues too.
 class FRPCContainer
 {
 public:
+	// A TimeToLive or MaxDepth of 0 means no limit.
+	void SetQueueLimits(ESchemaComponentType Type, float TimeToLive, uint32 MaxDepth);
+
 	void QueueRPC(FPendingRPCParamsPtr Params, ESchemaComponentType Type);
 	void ProcessRPCs(const FProcessRPCDelegate& FunctionToApply);
 	bool ObjectHasRPCsQueuedOfType(const Worker_EntityId& EntityId, ESchemaComponentType Type) const;
 
+	// Lets the queues of an entity blocked on an unresolved target be processed again by the next ProcessRPCs.
+	void UnblockEntity(Worker_EntityId EntityId);
+
+	// Drops every RPC queued for an entity, e.g. when it leaves view and its queues could otherwise stay blocked forever.
+	void DropEntity(Worker_EntityId EntityId);
+
 private:
-	using FArrayOfParams = TArray<FPendingRPCParamsPtr>;
-	using FRPCMap = TMap<Worker_EntityId_Key, FArrayOfParams>;
+	// FIFO ring buffer that grows to the next power of two when full.
+	class FRPCQueue
+	{
+	public:
+		void Push(FPendingRPCParamsPtr Params);
+		FPendingRPCParamsPtr Pop();
+
+		FPendingRPCParams& Peek() const { return *Slots[Head]; }
+		int32 Num() const { return Count; }
+
+	private:
+		TArray<FPendingRPCParamsPtr> Slots;
+		int32 Head = 0;
+		int32 Count = 0;
+	};
+
+	struct FQueueLimits
+	{
+		float TimeToLive = 0.0f;
+		uint32 MaxDepth = 0;
+	};
+
+	using FRPCMap = TMap<Worker_EntityId_Key, FRPCQueue>;
 	using RPCContainerType = TMap<ESchemaComponentType, FRPCMap>;
 
-	void ProcessRPCs(const FProcessRPCDelegate& FunctionToApply, FArrayOfParams& RPCList);
-	static bool ApplyFunction(const FProcessRPCDelegate& FunctionToApply, const FPendingRPCParams& Params);
+	EProcessRPCResult ProcessRPCs(const FProcessRPCDelegate& FunctionToApply, FRPCQueue& RPCQueue, const FQueueLimits* Limits, double Now);
+	static void ExpireRPCs(FRPCQueue& RPCQueue, const FQueueLimits* Limits, double Now);
 
 	RPCContainerType QueuedRPCs;
+	RPCContainerType BlockedRPCs;
+	TMap<ESchemaComponentType, FQueueLimits> QueueLimits;
 };
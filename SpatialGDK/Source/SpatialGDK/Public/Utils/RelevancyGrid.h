@@ -0,0 +1,77 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Uniform 2D grid (over X and Y) of replicated objects, used to find the objects near each net viewer without testing
+// every object against every viewer. Objects are keyed by an id (the UObject unique id for actors) and are only moved
+// between cells when they cross a cell boundary, so keeping the grid up to date is cheap for slow-moving objects.
+//
+// Each update pass is tagged: only objects updated since the last BeginUpdate() are returned by queries, along with
+// the index they were given in that pass.
+class SPATIALGDK_API FRelevancyGrid
+{
+public:
+	explicit FRelevancyGrid(float InCellSize);
+
+	void BeginUpdate();
+	void Update(uint32 Id, const FVector& Location, int32 UpdateIndex);
+	void Remove(uint32 Id);
+
+	int32 Num() const { return IdToEntry.Num(); }
+
+	// Calls Visitor(UpdateIndex, Location) for every object updated in the current pass whose location lies in a cell
+	// overlapping the circle of Radius around Center. Callers are expected to do their own exact distance check.
+	template <typename VisitorType>
+	void ForEachInRadius(const FVector& Center, float Radius, VisitorType&& Visitor) const
+	{
+		const FIntPoint MinCell = GetCell(Center - FVector(Radius, Radius, 0.f));
+		const FIntPoint MaxCell = GetCell(Center + FVector(Radius, Radius, 0.f));
+
+		for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+			{
+				const TArray<int32>* CellEntries = Cells.Find(FIntPoint(X, Y));
+				if (CellEntries == nullptr)
+				{
+					continue;
+				}
+
+				for (int32 EntryIndex : *CellEntries)
+				{
+					const FEntry& Entry = Entries[EntryIndex];
+					if (Entry.UpdatePass == CurrentUpdatePass)
+					{
+						Visitor(Entry.UpdateIndex, Entry.Location);
+					}
+				}
+			}
+		}
+	}
+
+private:
+	struct FEntry
+	{
+		FVector Location;
+		FIntPoint Cell;
+		int32 UpdateIndex;
+		uint32 UpdatePass;
+	};
+
+	FIntPoint GetCell(const FVector& Location) const
+	{
+		return FIntPoint(FMath::FloorToInt(Location.X * InvCellSize), FMath::FloorToInt(Location.Y * InvCellSize));
+	}
+
+	void RemoveFromCell(const FIntPoint& Cell, int32 EntryIndex);
+
+	float InvCellSize;
+	uint32 CurrentUpdatePass;
+
+	TMap<uint32, int32> IdToEntry;
+	TArray<FEntry> Entries;
+	TArray<int32> FreeEntries;
+	TMap<FIntPoint, TArray<int32>> Cells;
+};
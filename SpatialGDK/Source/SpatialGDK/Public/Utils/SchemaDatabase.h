@@ -72,6 +72,17 @@ struct FSubobjectSchemaData
 	}
 };
 
+// Parts of a class's FClassInfo that the schema generator can work out ahead of time, see USpatialClassInfoManager.
+USTRUCT()
+struct FClassInfoPrebuiltData
+{
+	GENERATED_USTRUCT_BODY()
+
+	// Names of the class's RPCs, in the order they are indexed in.
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	TArray<FName> RPCNames;
+};
+
 UCLASS()
 class SPATIALGDK_API USchemaDatabase : public UDataAsset
 {
@@ -96,7 +107,22 @@ public:
 	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
 	TSet<uint32> LevelComponentIds;
 
+	// Only contains the classes that were loaded the last time schema was generated for them.
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	TMap<FString, FClassInfoPrebuiltData> ClassPathToPrebuiltClassInfo;
+
 	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
 	uint32 NextAvailableComponentId;
+
+#if WITH_EDITORONLY_DATA
+	// Hash of everything the generated schema of a class depends on, used to skip rewriting schema for classes that haven't changed.
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	TMap<FString, FString> ClassPathToSchemaFingerprint;
+
+	// Hash of the saved state of a Blueprint class's package and the packages it depends on, used to skip loading Blueprints
+	// that haven't changed when doing a full scan.
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	TMap<FString, FString> ClassPathToPackageFingerprint;
+#endif // WITH_EDITORONLY_DATA
 };
 
@@ -0,0 +1,57 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/BitWriter.h"
+
+#include "EngineClasses/SpatialNetBitWriter.h"
+
+class USpatialPackageMapClient;
+
+namespace SpatialGDK
+{
+
+// Frame-scoped scratch memory for building schema data on the game thread.
+//
+// Schema objects are allocated by the Worker SDK, which gives each one its own arena that Schema_AllocateBuffer
+// draws from, and ownership passes to the SDK when they are sent. The heap traffic left on the GDK side is the bit
+// writer each struct or fast array property was serialized into before being copied into the schema object. Those
+// properties are written into the one writer held here instead, which is rewound between properties, so its buffer
+// only grows until it fits the largest property written. EndFrame() publishes the per-frame counters and drops the
+// buffer if a single large property made it grow past MaxRetainedBytes.
+class SPATIALGDK_API FSchemaScratch
+{
+public:
+	explicit FSchemaScratch(USpatialPackageMapClient* InPackageMap);
+
+	// Rewinds the scratch writer and returns it. Its data is only valid until the next call to BeginWrite.
+	FSpatialNetBitWriter& BeginWrite();
+
+	// Moves the objects the writer couldn't resolve since BeginWrite into OutUnresolvedObjects.
+	void EndWrite(TSet<TWeakObjectPtr<const UObject>>& OutUnresolvedObjects);
+
+	void CountSchemaObjectCreated() { SchemaObjectsCreated++; }
+
+	void EndFrame();
+
+	static constexpr int64 MaxRetainedBytes = 64 * 1024;
+
+private:
+	void CreateWriter();
+
+	USpatialPackageMapClient* PackageMap;
+
+	TSet<TWeakObjectPtr<const UObject>> UnresolvedObjects;
+	TUniquePtr<FSpatialNetBitWriter> Writer;
+	TUniquePtr<FBitWriterMark> EmptyMark;
+	bool bWriting = false;
+	int32 BufferBytesAtBeginWrite = 0;
+
+	// Counters for the current frame.
+	uint32 Writes = 0;
+	uint32 BufferAllocations = 0;
+	uint32 SchemaObjectsCreated = 0;
+};
+
+} // namespace SpatialGDK
@@ -113,14 +113,14 @@ inline void AddObjectRefToSchema(Schema_Object* Object, Schema_FieldId Id, const
 
 	Schema_AddEntityId(ObjectRefObject, 1, ObjectRef.Entity);
 	Schema_AddUint32(ObjectRefObject, 2, ObjectRef.Offset);
-	if (ObjectRef.Path)
+	if (ObjectRef.HasPath())
 	{
-		AddStringToSchema(ObjectRefObject, 3, *ObjectRef.Path);
+		AddStringToSchema(ObjectRefObject, 3, ObjectRef.GetPath());
 		Schema_AddBool(ObjectRefObject, 4, ObjectRef.bNoLoadOnClient);
 	}
-	if (ObjectRef.Outer)
+	if (ObjectRef.HasOuter())
 	{
-		AddObjectRefToSchema(ObjectRefObject, 5, *ObjectRef.Outer);
+		AddObjectRefToSchema(ObjectRefObject, 5, ObjectRef.GetOuter());
 	}
 }
 
@@ -136,7 +136,7 @@ inline FUnrealObjectRef IndexObjectRefFromSchema(Schema_Object* Object, Schema_F
 	ObjectRef.Offset = Schema_GetUint32(ObjectRefObject, 2);
 	if (Schema_GetObjectCount(ObjectRefObject, 3) > 0)
 	{
-		ObjectRef.Path = GetStringFromSchema(ObjectRefObject, 3);
+		ObjectRef.SetPath(GetStringFromSchema(ObjectRefObject, 3));
 	}
 	if (Schema_GetBoolCount(ObjectRefObject, 4) > 0)
 	{
@@ -144,7 +144,7 @@ inline FUnrealObjectRef IndexObjectRefFromSchema(Schema_Object* Object, Schema_F
 	}
 	if (Schema_GetObjectCount(ObjectRefObject, 5) > 0)
 	{
-		ObjectRef.Outer = GetObjectRefFromSchema(ObjectRefObject, 5);
+		ObjectRef.SetOuter(GetObjectRefFromSchema(ObjectRefObject, 5));
 	}
 
 	return ObjectRef;
@@ -3,9 +3,11 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Engine/World.h"
 #include "GameFramework/Actor.h"
 
 #include "EngineClasses/SpatialNetConnection.h"
+#include "EngineClasses/SpatialNetDriver.h"
 
 namespace SpatialGDK
 {
@@ -20,4 +22,20 @@ inline FString GetOwnerWorkerAttribute(AActor* Actor)
 	return FString();
 }
 
+// Call after changing a replicated property of an Actor or one of its subobjects when using dirty Actor replication.
+// Does nothing when not running with the Spatial net driver.
+inline void MarkDirtyForReplication(UObject* Object)
+{
+	UWorld* World = (Object != nullptr) ? Object->GetWorld() : nullptr;
+	if (World == nullptr)
+	{
+		return;
+	}
+
+	if (USpatialNetDriver* NetDriver = Cast<USpatialNetDriver>(World->GetNetDriver()))
+	{
+		NetDriver->MarkActorDirty(Object);
+	}
+}
+
 } // namespace SpatialGDK
@@ -46,6 +46,9 @@ public:
 
 	void TrackSentRPC(UFunction* Function, ESchemaComponentType RPCType, int PayloadSize);
 
+	// Called when coalesced component updates are flushed; QueuedCount updates were merged into SentCount messages.
+	void TrackCoalescedComponentUpdates(uint32 QueuedCount, uint32 SentCount);
+
 private:
 	UPROPERTY()
 	USpatialNetDriver* NetDriver;
@@ -72,5 +75,9 @@ private:
 	TMap<FString, RPCStat> RecentRPCs;
 	bool bRPCTrackingEnabled;
 	float RPCTrackingStartTime;
+
+	// Component updates queued and sent since the last metrics report, see FComponentUpdateCoalescer.
+	uint32 ComponentUpdatesQueuedSinceLastReport;
+	uint32 ComponentUpdatesSentSinceLastReport;
 };
 
@@ -200,8 +200,157 @@ bool IsReplicatedSubobject(TSharedPtr<FUnrealType> TypeInfo)
 	return false;
 }
 
-void GenerateSubobjectSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath)
+Worker_ComponentId ReuseOrAllocateComponentId(FComponentIdGenerator& IdGenerator, Worker_ComponentId ExistingComponentId)
 {
+	return ExistingComponentId != 0 ? ExistingComponentId : IdGenerator.Next();
+}
+
+const FActorSpecificSubobjectSchemaData* FindSubobjectSchemaData(const FActorSchemaData& ActorSchemaData, FName SubobjectName)
+{
+	for (auto& SubobjectIt : ActorSchemaData.SubobjectData)
+	{
+		if (SubobjectIt.Value.Name == SubobjectName)
+		{
+			return &SubobjectIt.Value;
+		}
+	}
+	return nullptr;
+}
+
+void AssignSubobjectComponentIds(FComponentIdGenerator& IdGenerator, UClass* Class, TSharedPtr<FUnrealType> TypeInfo)
+{
+	const FString ClassPath = Class->GetPathName();
+
+	// Use previously generated component IDs when possible.
+	const FSubobjectSchemaData* const ExistingSchemaData = SubobjectClassPathToSchema.Find(ClassPath);
+	if (ExistingSchemaData != nullptr && !ExistingSchemaData->GeneratedSchemaName.IsEmpty()
+		&& ExistingSchemaData->GeneratedSchemaName != ClassPathToSchemaName[ClassPath])
+	{
+		UE_LOG(LogSchemaGenerator, Error, TEXT("Saved generated schema name does not match in-memory version for class %s - schema %s : %s"),
+			*ClassPath, *ExistingSchemaData->GeneratedSchemaName, *ClassPathToSchemaName[ClassPath]);
+		UE_LOG(LogSchemaGenerator, Error, TEXT("Schema generation may have resulted in component name clash, recommend you perform a full schema generation"));
+	}
+
+	FUnrealFlatRepData RepData = GetFlatRepData(TypeInfo);
+	const bool bHasHandoverData = GetFlatHandoverData(TypeInfo).Num() > 0;
+
+	FSubobjectSchemaData SubobjectSchemaData;
+	SubobjectSchemaData.GeneratedSchemaName = ClassPathToSchemaName[ClassPath];
+
+	// Use the max number of dynamically attached subobjects per class to generate
+	// that many schema components for this subobject.
+	const uint32 DynamicComponentsPerClass = GetDefault<USpatialGDKSettings>()->MaxDynamicallyAttachedSubobjectsPerClass;
+
+	for (uint32 i = 1; i <= DynamicComponentsPerClass; i++)
+	{
+		FDynamicSubobjectSchemaData DynamicSubobjectComponents;
+
+		for (EReplicatedPropertyGroup Group : GetAllReplicatedPropertyGroups())
+		{
+			// Every subobject gets a REP_MultiClient component, even with no replicated properties, see GenerateSubobjectSchema.
+			if (RepData[Group].Num() == 0 && Group == REP_SingleClient)
+			{
+				continue;
+			}
+
+			const ESchemaComponentType ComponentType = PropertyGroupToSchemaComponentType(Group);
+			DynamicSubobjectComponents.SchemaComponents[ComponentType] = ReuseOrAllocateComponentId(IdGenerator,
+				ExistingSchemaData != nullptr ? ExistingSchemaData->GetDynamicSubobjectComponentId(i - 1, ComponentType) : 0);
+		}
+
+		if (bHasHandoverData)
+		{
+			DynamicSubobjectComponents.SchemaComponents[SCHEMA_Handover] = ReuseOrAllocateComponentId(IdGenerator,
+				ExistingSchemaData != nullptr ? ExistingSchemaData->GetDynamicSubobjectComponentId(i - 1, SCHEMA_Handover) : 0);
+		}
+
+		SubobjectSchemaData.DynamicSubobjectComponents.Add(MoveTemp(DynamicSubobjectComponents));
+	}
+
+	SubobjectClassPathToSchema.Add(ClassPath, SubobjectSchemaData);
+}
+
+void AssignActorComponentIds(FComponentIdGenerator& IdGenerator, UClass* Class, TSharedPtr<FUnrealType> TypeInfo)
+{
+	const FString ClassPath = Class->GetPathName();
+
+	// Use previously generated component IDs when possible.
+	const FActorSchemaData* const ExistingSchemaData = ActorClassPathToSchema.Find(ClassPath);
+
+	FActorSchemaData ActorSchemaData;
+	ActorSchemaData.GeneratedSchemaName = ClassPathToSchemaName[ClassPath];
+
+	FUnrealFlatRepData RepData = GetFlatRepData(TypeInfo);
+	for (EReplicatedPropertyGroup Group : GetAllReplicatedPropertyGroups())
+	{
+		if (RepData[Group].Num() == 0)
+		{
+			continue;
+		}
+
+		const ESchemaComponentType ComponentType = PropertyGroupToSchemaComponentType(Group);
+		ActorSchemaData.SchemaComponents[ComponentType] = ReuseOrAllocateComponentId(IdGenerator,
+			ExistingSchemaData != nullptr ? ExistingSchemaData->SchemaComponents[ComponentType] : 0);
+	}
+
+	if (GetFlatHandoverData(TypeInfo).Num() > 0)
+	{
+		ActorSchemaData.SchemaComponents[SCHEMA_Handover] = ReuseOrAllocateComponentId(IdGenerator,
+			ExistingSchemaData != nullptr ? ExistingSchemaData->SchemaComponents[SCHEMA_Handover] : 0);
+	}
+
+	// Statically attached subobjects, in the order their components are written by GenerateSubobjectSchemaForActor.
+	for (auto& It : GetAllSubobjects(TypeInfo))
+	{
+		TSharedPtr<FUnrealType>& SubobjectTypeInfo = It.Value;
+		UClass* SubobjectClass = Cast<UClass>(SubobjectTypeInfo->Type);
+
+		if (!SchemaGeneratedClasses.Contains(SubobjectClass))
+		{
+			continue;
+		}
+
+		const FActorSpecificSubobjectSchemaData* ExistingSubobjectSchemaData = nullptr;
+		if (ExistingSchemaData != nullptr)
+		{
+			ExistingSubobjectSchemaData = FindSubobjectSchemaData(*ExistingSchemaData, SubobjectTypeInfo->Name);
+		}
+
+		FActorSpecificSubobjectSchemaData SubobjectData;
+		SubobjectData.ClassPath = SubobjectClass->GetPathName();
+		SubobjectData.Name = SubobjectTypeInfo->Name;
+
+		FUnrealFlatRepData SubobjectRepData = GetFlatRepData(SubobjectTypeInfo);
+		for (EReplicatedPropertyGroup Group : GetAllReplicatedPropertyGroups())
+		{
+			if (SubobjectRepData[Group].Num() == 0 && Group == REP_SingleClient)
+			{
+				continue;
+			}
+
+			const ESchemaComponentType ComponentType = PropertyGroupToSchemaComponentType(Group);
+			SubobjectData.SchemaComponents[ComponentType] = ReuseOrAllocateComponentId(IdGenerator,
+				ExistingSubobjectSchemaData != nullptr ? ExistingSubobjectSchemaData->SchemaComponents[ComponentType] : 0);
+		}
+
+		if (GetFlatHandoverData(SubobjectTypeInfo).Num() > 0)
+		{
+			SubobjectData.SchemaComponents[SCHEMA_Handover] = ReuseOrAllocateComponentId(IdGenerator,
+				ExistingSubobjectSchemaData != nullptr ? ExistingSubobjectSchemaData->SchemaComponents[SCHEMA_Handover] : 0);
+		}
+
+		uint32 SubobjectOffset = SubobjectData.SchemaComponents[SCHEMA_Data];
+		check(SubobjectOffset != 0);
+		ActorSchemaData.SubobjectData.Add(SubobjectOffset, SubobjectData);
+	}
+
+	ActorClassPathToSchema.Add(ClassPath, ActorSchemaData);
+}
+
+void GenerateSubobjectSchema(UClass* Class, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath)
+{
+	const FSubobjectSchemaData& SubobjectSchemaData = SubobjectClassPathToSchema.FindChecked(Class->GetPathName());
+
 	FCodeWriter Writer;
 
 	Writer.Printf(R"""(
@@ -293,31 +442,10 @@ void GenerateSubobjectSchema(FComponentIdGenerator& IdGenerator, UClass* Class,
 		Writer.Outdent().Print("}");
 	}
 
-	// Use the max number of dynamically attached subobjects per class to generate
-	// that many schema components for this subobject.
-	const uint32 DynamicComponentsPerClass = GetDefault<USpatialGDKSettings>()->MaxDynamicallyAttachedSubobjectsPerClass;
-
-	FSubobjectSchemaData SubobjectSchemaData;
-
-	// Use previously generated component IDs when possible.
-	const FSubobjectSchemaData* const ExistingSchemaData = SubobjectClassPathToSchema.Find(Class->GetPathName());
-	if (ExistingSchemaData != nullptr && !ExistingSchemaData->GeneratedSchemaName.IsEmpty()
-		&& ExistingSchemaData->GeneratedSchemaName != ClassPathToSchemaName[Class->GetPathName()])
-	{
-		UE_LOG(LogSchemaGenerator, Error, TEXT("Saved generated schema name does not match in-memory version for class %s - schema %s : %s"),
-			*Class->GetPathName(), *ExistingSchemaData->GeneratedSchemaName, *ClassPathToSchemaName[Class->GetPathName()]);
-		UE_LOG(LogSchemaGenerator, Error, TEXT("Schema generation may have resulted in component name clash, recommend you perform a full schema generation"));
-	}
-
-	for (uint32 i = 1; i <= DynamicComponentsPerClass; i++)
+	for (int32 i = 1; i <= SubobjectSchemaData.DynamicSubobjectComponents.Num(); i++)
 	{
-		FDynamicSubobjectSchemaData DynamicSubobjectComponents;
-
 		for (EReplicatedPropertyGroup Group : GetAllReplicatedPropertyGroups())
 		{
-			// Since it is possible to replicate subobjects which have no replicated properties.
-			// We need to generate a schema component for every subobject. So if we have no replicated
-			// properties, we only don't generate a schema component if we are REP_SingleClient
 			if (RepData[Group].Num() == 0 && Group == REP_SingleClient)
 			{
 				continue;
@@ -325,16 +453,7 @@ void GenerateSubobjectSchema(FComponentIdGenerator& IdGenerator, UClass* Class,
 
 			Writer.PrintNewLine();
 
-			Worker_ComponentId ComponentId = 0;
-			if (ExistingSchemaData != nullptr)
-			{
-				ComponentId = ExistingSchemaData->GetDynamicSubobjectComponentId(i - 1, PropertyGroupToSchemaComponentType(Group));
-			}
-
-			if (ComponentId == 0)
-			{
-				ComponentId = IdGenerator.Next();
-			}
+			Worker_ComponentId ComponentId = SubobjectSchemaData.GetDynamicSubobjectComponentId(i - 1, PropertyGroupToSchemaComponentType(Group));
 			FString ComponentName = SchemaReplicatedDataName(Group, Class) + TEXT("Dynamic") + FString::FromInt(i);
 
 			Writer.Printf("component {0} {", *ComponentName);
@@ -342,24 +461,13 @@ void GenerateSubobjectSchema(FComponentIdGenerator& IdGenerator, UClass* Class,
 			Writer.Printf("id = {0};", ComponentId);
 			Writer.Printf("data {0};", *SchemaReplicatedDataName(Group, Class));
 			Writer.Outdent().Print("}");
-
-			DynamicSubobjectComponents.SchemaComponents[PropertyGroupToSchemaComponentType(Group)] = ComponentId;
 		}
 
 		if (HandoverData.Num() > 0)
 		{
 			Writer.PrintNewLine();
 
-			Worker_ComponentId ComponentId = 0;
-			if (ExistingSchemaData != nullptr)
-			{
-				ComponentId = ExistingSchemaData->GetDynamicSubobjectComponentId(i - 1, SCHEMA_Handover);
-			}
-
-			if (ComponentId == 0)
-			{
-				ComponentId = IdGenerator.Next();
-			}
+			Worker_ComponentId ComponentId = SubobjectSchemaData.GetDynamicSubobjectComponentId(i - 1, SCHEMA_Handover);
 			FString ComponentName = SchemaHandoverDataName(Class) + TEXT("Dynamic") + FString::FromInt(i);
 
 			Writer.Printf("component {0} {", *ComponentName);
@@ -367,21 +475,15 @@ void GenerateSubobjectSchema(FComponentIdGenerator& IdGenerator, UClass* Class,
 			Writer.Printf("id = {0};", ComponentId);
 			Writer.Printf("data {0};", *SchemaHandoverDataName(Class));
 			Writer.Outdent().Print("}");
-
-			DynamicSubobjectComponents.SchemaComponents[SCHEMA_Handover] = ComponentId;
 		}
-
-		SubobjectSchemaData.DynamicSubobjectComponents.Add(MoveTemp(DynamicSubobjectComponents));
 	}
 
 	Writer.WriteToFile(FString::Printf(TEXT("%s%s.schema"), *SchemaPath, *ClassPathToSchemaName[Class->GetPathName()]));
-	SubobjectSchemaData.GeneratedSchemaName = ClassPathToSchemaName[Class->GetPathName()];
-	SubobjectClassPathToSchema.Add(Class->GetPathName(), SubobjectSchemaData);
 }
 
-void GenerateActorSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath)
+void GenerateActorSchema(UClass* Class, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath)
 {
-	const FActorSchemaData* const SchemaData = ActorClassPathToSchema.Find(Class->GetPathName());
+	const FActorSchemaData& ActorSchemaData = ActorClassPathToSchema.FindChecked(Class->GetPathName());
 
 	FCodeWriter Writer;
 
@@ -395,9 +497,6 @@ void GenerateActorSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSha
 	Writer.PrintNewLine();
 	Writer.Printf("import \"unreal/gdk/core_types.schema\";");
 
-	FActorSchemaData ActorSchemaData;
-	ActorSchemaData.GeneratedSchemaName = ClassPathToSchemaName[Class->GetPathName()];
-
 	FUnrealFlatRepData RepData = GetFlatRepData(TypeInfo);
 
 	// Client-server replicated properties.
@@ -408,7 +507,7 @@ void GenerateActorSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSha
 			continue;
 		}
 
-		// If this class is an Actor, it MUST have bTearOff at field ID 3.	
+		// If this class is an Actor, it MUST have bTearOff at field ID 3.
 		if (Group == REP_MultiClient && Class->IsChildOf<AActor>())
 		{
 			TSharedPtr<FUnrealProperty> ExpectedReplicatesPropData = RepData[Group].FindRef(SpatialConstants::ACTOR_TEAROFF_ID);
@@ -422,23 +521,11 @@ void GenerateActorSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSha
 			}
 		}
 
-		Worker_ComponentId ComponentId = 0;
-		if (SchemaData != nullptr && SchemaData->SchemaComponents[PropertyGroupToSchemaComponentType(Group)] != 0)
-		{
-			ComponentId = SchemaData->SchemaComponents[PropertyGroupToSchemaComponentType(Group)];
-		}
-		else
-		{
-			ComponentId = IdGenerator.Next();
-		}
-
 		Writer.PrintNewLine();
 
 		Writer.Printf("component {0} {", *SchemaReplicatedDataName(Group, Class));
 		Writer.Indent();
-		Writer.Printf("id = {0};", ComponentId);
-
-		ActorSchemaData.SchemaComponents[PropertyGroupToSchemaComponentType(Group)] = ComponentId;
+		Writer.Printf("id = {0};", ActorSchemaData.SchemaComponents[PropertyGroupToSchemaComponentType(Group)]);
 
 		int FieldCounter = 0;
 		for (auto& RepProp : RepData[Group])
@@ -455,24 +542,12 @@ void GenerateActorSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSha
 	FCmdHandlePropertyMap HandoverData = GetFlatHandoverData(TypeInfo);
 	if (HandoverData.Num() > 0)
 	{
-		Worker_ComponentId ComponentId = 0;
-		if (SchemaData != nullptr && SchemaData->SchemaComponents[ESchemaComponentType::SCHEMA_Handover] != 0)
-		{
-			ComponentId = SchemaData->SchemaComponents[ESchemaComponentType::SCHEMA_Handover];
-		}
-		else
-		{
-			ComponentId = IdGenerator.Next();
-		}
-
 		Writer.PrintNewLine();
 
 		// Handover (server to server) replicated properties.
 		Writer.Printf("component {0} {", *SchemaHandoverDataName(Class));
 		Writer.Indent();
-		Writer.Printf("id = {0};", ComponentId);
-
-		ActorSchemaData.SchemaComponents[ESchemaComponentType::SCHEMA_Handover] = ComponentId;
+		Writer.Printf("id = {0};", ActorSchemaData.SchemaComponents[ESchemaComponentType::SCHEMA_Handover]);
 
 		int FieldCounter = 0;
 		for (auto& Prop : HandoverData)
@@ -485,20 +560,15 @@ void GenerateActorSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSha
 		Writer.Outdent().Print("}");
 	}
 
-	GenerateSubobjectSchemaForActor(IdGenerator, Class, TypeInfo, SchemaPath, ActorSchemaData, ActorClassPathToSchema.Find(Class->GetPathName()));
-
-	ActorClassPathToSchema.Add(Class->GetPathName(), ActorSchemaData);
+	GenerateSubobjectSchemaForActor(Class, TypeInfo, SchemaPath, ActorSchemaData);
 
 	Writer.WriteToFile(FString::Printf(TEXT("%s%s.schema"), *SchemaPath, *ClassPathToSchemaName[Class->GetPathName()]));
 }
 
-FActorSpecificSubobjectSchemaData GenerateSchemaForStaticallyAttachedSubobject(FCodeWriter& Writer, FComponentIdGenerator& IdGenerator, FString PropertyName, TSharedPtr<FUnrealType>& TypeInfo, UClass* ComponentClass, UClass* ActorClass, int MapIndex, const FActorSpecificSubobjectSchemaData* ExistingSchemaData)
+void GenerateSchemaForStaticallyAttachedSubobject(FCodeWriter& Writer, FString PropertyName, TSharedPtr<FUnrealType>& TypeInfo, UClass* ComponentClass, const FActorSpecificSubobjectSchemaData& SubobjectData)
 {
 	FUnrealFlatRepData RepData = GetFlatRepData(TypeInfo);
 
-	FActorSpecificSubobjectSchemaData SubobjectData;
-	SubobjectData.ClassPath = ComponentClass->GetPathName();
-
 	for (EReplicatedPropertyGroup Group : GetAllReplicatedPropertyGroups())
 	{
 		// Since it is possible to replicate subobjects which have no replicated properties.
@@ -509,57 +579,31 @@ FActorSpecificSubobjectSchemaData GenerateSchemaForStaticallyAttachedSubobject(F
 			continue;
 		}
 
-		Worker_ComponentId ComponentId = 0;
-		if (ExistingSchemaData != nullptr && ExistingSchemaData->SchemaComponents[PropertyGroupToSchemaComponentType(Group)] != 0)
-		{
-			ComponentId = ExistingSchemaData->SchemaComponents[PropertyGroupToSchemaComponentType(Group)];
-		}
-		else
-		{
-			ComponentId = IdGenerator.Next();
-		}
-
 		Writer.PrintNewLine();
 
 		FString ComponentName = PropertyName + GetReplicatedPropertyGroupName(Group);
 		Writer.Printf("component {0} {", *ComponentName);
 		Writer.Indent();
-		Writer.Printf("id = {0};", ComponentId);
+		Writer.Printf("id = {0};", SubobjectData.SchemaComponents[PropertyGroupToSchemaComponentType(Group)]);
 		Writer.Printf("data unreal.generated.{0};", *SchemaReplicatedDataName(Group, ComponentClass));
 		Writer.Outdent().Print("}");
-
-		SubobjectData.SchemaComponents[PropertyGroupToSchemaComponentType(Group)] = ComponentId;
 	}
 
 	FCmdHandlePropertyMap HandoverData = GetFlatHandoverData(TypeInfo);
 	if (HandoverData.Num() > 0)
 	{
-		Worker_ComponentId ComponentId = 0;
-		if (ExistingSchemaData != nullptr && ExistingSchemaData->SchemaComponents[ESchemaComponentType::SCHEMA_Handover] != 0)
-		{
-			ComponentId = ExistingSchemaData->SchemaComponents[ESchemaComponentType::SCHEMA_Handover];
-		}
-		else
-		{
-			ComponentId = IdGenerator.Next();
-		}
-
 		Writer.PrintNewLine();
 
 		// Handover (server to server) replicated properties.
 		Writer.Printf("component {0} {", *(PropertyName + TEXT("Handover")));
 		Writer.Indent();
-		Writer.Printf("id = {0};", ComponentId);
+		Writer.Printf("id = {0};", SubobjectData.SchemaComponents[ESchemaComponentType::SCHEMA_Handover]);
 		Writer.Printf("data unreal.generated.{0};", *SchemaHandoverDataName(ComponentClass));
 		Writer.Outdent().Print("}");
-
-		SubobjectData.SchemaComponents[ESchemaComponentType::SCHEMA_Handover] = ComponentId;
 	}
-
-	return SubobjectData;
 }
 
-void GenerateSubobjectSchemaForActor(FComponentIdGenerator& IdGenerator, UClass* ActorClass, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath, FActorSchemaData& ActorSchemaData, const FActorSchemaData* ExistingSchemaData)
+void GenerateSubobjectSchemaForActor(UClass* ActorClass, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath, const FActorSchemaData& ActorSchemaData)
 {
 	FCodeWriter Writer;
 
@@ -582,35 +626,16 @@ void GenerateSubobjectSchemaForActor(FComponentIdGenerator& IdGenerator, UClass*
 		TSharedPtr<FUnrealType>& SubobjectTypeInfo = It.Value;
 		UClass* SubobjectClass = Cast<UClass>(SubobjectTypeInfo->Type);
 
-		FActorSpecificSubobjectSchemaData SubobjectData;
-
-		if (SchemaGeneratedClasses.Contains(SubobjectClass))
-		{
-			bHasComponents = true;
-
-			const FActorSpecificSubobjectSchemaData* ExistingSubobjectSchemaData = nullptr;
-			if (ExistingSchemaData != nullptr)
-			{
-				for (auto& SubobjectIt : ExistingSchemaData->SubobjectData)
-				{
-					if (SubobjectIt.Value.Name == SubobjectTypeInfo->Name)
-					{
-						ExistingSubobjectSchemaData = &SubobjectIt.Value;
-						break;
-					}
-				}
-			}
-			SubobjectData = GenerateSchemaForStaticallyAttachedSubobject(Writer, IdGenerator, UnrealNameToSchemaComponentName(SubobjectTypeInfo->Name.ToString()), SubobjectTypeInfo, SubobjectClass, ActorClass, 0, ExistingSubobjectSchemaData);
-		}
-		else
+		if (!SchemaGeneratedClasses.Contains(SubobjectClass))
 		{
 			continue;
 		}
 
-		SubobjectData.Name = SubobjectTypeInfo->Name;
-		uint32 SubobjectOffset = SubobjectData.SchemaComponents[SCHEMA_Data];
-		check(SubobjectOffset != 0);
-		ActorSchemaData.SubobjectData.Add(SubobjectOffset, SubobjectData);
+		bHasComponents = true;
+
+		const FActorSpecificSubobjectSchemaData* SubobjectData = FindSubobjectSchemaData(ActorSchemaData, SubobjectTypeInfo->Name);
+		check(SubobjectData != nullptr);
+		GenerateSchemaForStaticallyAttachedSubobject(Writer, UnrealNameToSchemaComponentName(SubobjectTypeInfo->Name.ToString()), SubobjectTypeInfo, SubobjectClass, *SubobjectData);
 	}
 
 	if (bHasComponents)
@@ -619,6 +644,7 @@ void GenerateSubobjectSchemaForActor(FComponentIdGenerator& IdGenerator, UClass*
 	}
 }
 
+
 void GenerateSubobjectSchemaForActorIncludes(FCodeWriter& Writer, TSharedPtr<FUnrealType>& TypeInfo)
 {
 	TSet<UStruct*> AlreadyImported;
@@ -15,15 +15,24 @@ extern TMap<FString, FActorSchemaData> ActorClassPathToSchema;
 extern TMap<FString, FSubobjectSchemaData> SubobjectClassPathToSchema;
 extern TMap<FString, uint32> LevelPathToComponentId;
 
+// Assigns the component ids of an Actor class's schema files and records them in ActorClassPathToSchema, reusing the
+// previously generated ids where possible. Ids are taken from IdGenerator in the order the components are written, so
+// classes must be visited in a fixed order for the ids to be deterministic.
+void AssignActorComponentIds(FComponentIdGenerator& IdGenerator, UClass* Class, TSharedPtr<FUnrealType> TypeInfo);
+// Assigns the component ids of a Subobject class's dynamic schema components and records them in SubobjectClassPathToSchema.
+void AssignSubobjectComponentIds(FComponentIdGenerator& IdGenerator, UClass* Class, TSharedPtr<FUnrealType> TypeInfo);
+
+// The functions below only write schema files using the ids assigned above, and don't modify any shared state, so
+// different classes can be generated on different threads.
+
 // Generates schema for an Actor
-void GenerateActorSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath);
+void GenerateActorSchema(UClass* Class, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath);
 // Generates schema for a Subobject class - the schema type and the dynamic schema components
-void GenerateSubobjectSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath);
+void GenerateSubobjectSchema(UClass* Class, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath);
 // Generates schema for all statically attached subobjects on an Actor.
-void GenerateSubobjectSchemaForActor(FComponentIdGenerator& IdGenerator, UClass* ActorClass, TSharedPtr<FUnrealType> TypeInfo,
-	FString SchemaPath, FActorSchemaData& ActorSchemaData, const FActorSchemaData* ExistingSchemaData);
+void GenerateSubobjectSchemaForActor(UClass* ActorClass, TSharedPtr<FUnrealType> TypeInfo, FString SchemaPath, const FActorSchemaData& ActorSchemaData);
 // Generates schema for a statically attached subobject on an Actor - called by GenerateSubobjectSchemaForActor.
-FActorSpecificSubobjectSchemaData GenerateSchemaForStaticallyAttachedSubobject(FCodeWriter& Writer, FComponentIdGenerator& IdGenerator,
-	FString PropertyName, TSharedPtr<FUnrealType>& TypeInfo, UClass* ComponentClass, const FActorSpecificSubobjectSchemaData* ExistingSchemaData);
+void GenerateSchemaForStaticallyAttachedSubobject(FCodeWriter& Writer, FString PropertyName, TSharedPtr<FUnrealType>& TypeInfo, UClass* ComponentClass,
+	const FActorSpecificSubobjectSchemaData& SubobjectData);
 // Output the includes required by this schema file.
 void GenerateSubobjectSchemaForActorIncludes(FCodeWriter& Writer, TSharedPtr<FUnrealType>& TypeInfo);
@@ -5,8 +5,11 @@
 #include "Abilities/GameplayAbility.h"
 #include "AssetRegistryModule.h"
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
 #include "Components/SceneComponent.h"
 #include "Editor.h"
+#include "Engine/Blueprint.h"
 #include "Engine/LevelScriptActor.h"
 #include "Engine/LevelStreaming.h"
 #include "Engine/World.h"
@@ -18,6 +21,7 @@
 #include "Misc/FileHelper.h"
 #include "Misc/MessageDialog.h"
 #include "Misc/MonitoredProcess.h"
+#include "Misc/SecureHash.h"
 #include "Templates/SharedPointer.h"
 #include "UObject/UObjectIterator.h"
 
@@ -29,11 +33,14 @@
 #include "SpatialConstants.h"
 #include "SpatialGDKEditorSettings.h"
 #include "SpatialGDKServicesModule.h"
+#include "SpatialGDKSettings.h"
 #include "TypeStructure.h"
 #include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectHash.h"
 #include "Utils/CodeWriter.h"
 #include "Utils/ComponentIdGenerator.h"
 #include "Utils/DataTypeUtilities.h"
+#include "Utils/RepLayoutUtils.h"
 #include "Utils/SchemaDatabase.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialGDKSchemaGenerator);
@@ -48,6 +55,15 @@ uint32 NextAvailableComponentId;
 TMap<FString, uint32> LevelPathToComponentId;
 TSet<uint32> LevelComponentIds;
 
+TMap<FString, FClassInfoPrebuiltData> ClassPathToPrebuiltClassInfo;
+
+// Incremental generation, see GetSchemaFingerprint and GetPackageFingerprint.
+TMap<FString, FString> ClassPathToSchemaFingerprint;
+TMap<FString, FString> ClassPathToPackageFingerprint;
+TSet<FString> UpToDateBlueprintClassPaths;
+TMap<FString, FString> NativeClassFingerprints;
+TMap<FString, FString> ScriptPackageFingerprints;
+
 // Prevent name collisions.
 TMap<FString, FString> ClassPathToSchemaName;
 TMap<FString, FString> SchemaNameToClassPath;
@@ -56,6 +72,17 @@ TMap<FString, TSet<FString>> PotentialSchemaNameCollisions;
 namespace
 {
 
+// Seconds spent in each step of SpatialGDKGenerateSchema, logged once it has finished.
+struct FSchemaGenerationTimings
+{
+	double TypeInfos = 0.0;
+	double ComponentIds = 0.0;
+	double Emission = 0.0;
+	int32 NumEmissionThreads = 1;
+	double Sublevels = 0.0;
+	double SchemaCompiler = 0.0;
+};
+
 void AddPotentialNameCollision(const FString& DesiredSchemaName, const FString& ClassPath, const FString& GeneratedSchemaName)
 {
 	PotentialSchemaNameCollisions.FindOrAdd(DesiredSchemaName).Add(FString::Printf(TEXT("%s(%s)"), *ClassPath, *GeneratedSchemaName));
@@ -66,18 +93,286 @@ void OnStatusOutput(FString Message)
 	UE_LOG(LogSpatialGDKSchemaGenerator, Log, TEXT("%s"), *Message);
 }
 
-void GenerateCompleteSchemaFromClass(FString SchemaPath, FComponentIdGenerator& IdGenerator, TSharedPtr<FUnrealType> TypeInfo)
+// Bump whenever the schema generated for an unchanged class changes, so that the next generation rewrites everything.
+const int32 SchemaFingerprintVersion = 1;
+
+void AppendPropertyFingerprint(FString& Text, const TSharedPtr<FUnrealProperty>& Prop, uint16 Handle)
+{
+	Text += FString::Printf(TEXT("%u %s %s %d;"), Handle, *SchemaFieldName(Prop), *Prop->Property->GetCPPType(), Prop->Property->ArrayDim);
+}
+
+// Describes the replicated properties, handover properties and RPC signatures of a type, which is everything the schema
+// of a class takes from the class itself.
+FString GetTypeFingerprintText(TSharedPtr<FUnrealType> TypeInfo)
+{
+	FString Text;
+
+	FUnrealFlatRepData RepData = GetFlatRepData(TypeInfo);
+	for (EReplicatedPropertyGroup Group : GetAllReplicatedPropertyGroups())
+	{
+		Text += FString::Printf(TEXT("rep %d {"), static_cast<int32>(Group));
+		for (auto& RepProp : RepData[Group])
+		{
+			AppendPropertyFingerprint(Text, RepProp.Value, RepProp.Key);
+		}
+		Text += TEXT("}");
+	}
+
+	Text += TEXT("handover {");
+	for (auto& Prop : GetFlatHandoverData(TypeInfo))
+	{
+		AppendPropertyFingerprint(Text, Prop.Value, Prop.Key);
+	}
+	Text += TEXT("}");
+
+	FUnrealRPCsByType RPCsByType = GetAllRPCsByType(TypeInfo);
+	for (ERPCType Type : GetRPCTypes())
+	{
+		Text += FString::Printf(TEXT("rpc %d {"), static_cast<int32>(Type));
+		for (const TSharedPtr<FUnrealRPC>& RPC : RPCsByType[Type])
+		{
+			Text += FString::Printf(TEXT("%s %d ("), *SchemaRPCName(RPC->Function), RPC->bReliable ? 1 : 0);
+			for (TFieldIterator<UProperty> It(RPC->Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+			{
+				Text += FString::Printf(TEXT("%s %s %d,"), *It->GetName(), *It->GetCPPType(), It->ArrayDim);
+			}
+			Text += TEXT(");");
+		}
+		Text += TEXT("}");
+	}
+
+	return Text;
+}
+
+// Hash of everything the schema files generated for a class depend on. Schema names must have been resolved already.
+FString GetSchemaFingerprint(UClass* Class, TSharedPtr<FUnrealType> TypeInfo)
+{
+	FString Text = FString::Printf(TEXT("v%d %s %d %u;"), SchemaFingerprintVersion, *ClassPathToSchemaName[Class->GetPathName()],
+		Class->IsChildOf<AActor>() ? 1 : 0, GetDefault<USpatialGDKSettings>()->MaxDynamicallyAttachedSubobjectsPerClass);
+	Text += GetTypeFingerprintText(TypeInfo);
+
+	// An Actor's components file refers to the types generated for its subobjects' classes.
+	if (Class->IsChildOf<AActor>())
+	{
+		for (auto& It : GetAllSubobjects(TypeInfo))
+		{
+			UClass* SubobjectClass = Cast<UClass>(It.Value->Type);
+			if (!SchemaGeneratedClasses.Contains(SubobjectClass))
+			{
+				continue;
+			}
+
+			FUnrealFlatRepData SubobjectRepData = GetFlatRepData(It.Value);
+			Text += FString::Printf(TEXT("subobject %s %s %d %d;"), *It.Value->Name.ToString(), *ClassPathToSchemaName[SubobjectClass->GetPathName()],
+				SubobjectRepData[REP_SingleClient].Num() > 0 ? 1 : 0, GetFlatHandoverData(It.Value).Num() > 0 ? 1 : 0);
+		}
+	}
+
+	return FMD5::HashAnsiString(*Text);
+}
+
+FString GetNativeClassFingerprint(UClass* NativeClass)
+{
+	const FString ClassPath = NativeClass->GetPathName();
+	if (const FString* Fingerprint = NativeClassFingerprints.Find(ClassPath))
+	{
+		return *Fingerprint;
+	}
+
+	const FString Fingerprint = FMD5::HashAnsiString(*GetTypeFingerprintText(CreateUnrealTypeInfo(NativeClass, 0, 0, false)));
+	NativeClassFingerprints.Add(ClassPath, Fingerprint);
+	return Fingerprint;
+}
+
+bool HasReplicatedFields(UClass* Class)
+{
+	for (TFieldIterator<UProperty> It(Class); It; ++It)
+	{
+		if (It->PropertyFlags & (CPF_Net | CPF_Handover))
+		{
+			return true;
+		}
+	}
+
+	for (TFieldIterator<UFunction> It(Class); It; ++It)
+	{
+		if (It->FunctionFlags & FUNC_Net)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// Hash of the native classes in a script package that a Blueprint could have as subobjects. Actor classes are left out, as
+// the only native Actor class a Blueprint's schema depends on is its native parent.
+FString GetScriptPackageFingerprint(FName ScriptPackageName)
+{
+	const FString PackagePath = ScriptPackageName.ToString();
+	if (const FString* Fingerprint = ScriptPackageFingerprints.Find(PackagePath))
+	{
+		return *Fingerprint;
+	}
+
+	TArray<FString> ClassFingerprints;
+	if (UPackage* Package = FindPackage(nullptr, *PackagePath))
+	{
+		TArray<UObject*> Objects;
+		GetObjectsWithOuter(Package, Objects, /* bIncludeNestedObjects */ false);
+		for (UObject* Object : Objects)
+		{
+			UClass* Class = Cast<UClass>(Object);
+			if (Class != nullptr && !Class->IsChildOf<AActor>() && !Class->HasAnySpatialClassFlags(SPATIALCLASS_NotSpatialType) && HasReplicatedFields(Class))
+			{
+				ClassFingerprints.Add(Class->GetName() + TEXT(" ") + GetNativeClassFingerprint(Class));
+			}
+		}
+	}
+
+	// Objects aren't returned in a stable order.
+	ClassFingerprints.Sort();
+
+	const FString Fingerprint = FMD5::HashAnsiString(*FString::Join(ClassFingerprints, TEXT(";")));
+	ScriptPackageFingerprints.Add(PackagePath, Fingerprint);
+	return Fingerprint;
+}
+
+// Hash of everything a Blueprint's schema depends on that can be worked out from the asset registry without loading the
+// Blueprint: the saved state of its package and every content package it depends on, the native class it derives from,
+// the native classes with replicated fields in the script packages it depends on, and the settings that affect schema.
+// Returns an empty string if the state of any of the packages is unknown, or if any of them is loaded with unsaved changes,
+// since the asset registry only knows the saved state. Blueprints with an empty fingerprint are always loaded.
+FString GetPackageFingerprint(FName PackageName, UClass* NativeParentClass)
+{
+	if (NativeParentClass == nullptr)
+	{
+		return FString();
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+
+	TArray<FName> Packages;
+	TSet<FName> VisitedPackages;
+	Packages.Add(PackageName);
+	VisitedPackages.Add(PackageName);
+
+	TArray<FString> PackageStates;
+	TSet<FName> ScriptPackages;
+	for (int32 i = 0; i < Packages.Num(); i++)
+	{
+		const FAssetPackageData* PackageData = AssetRegistry.GetAssetPackageData(Packages[i]);
+		if (PackageData == nullptr)
+		{
+			return FString();
+		}
+
+		const UPackage* LoadedPackage = FindPackage(nullptr, *Packages[i].ToString());
+		if (LoadedPackage != nullptr && LoadedPackage->IsDirty())
+		{
+			return FString();
+		}
+
+		PackageStates.Add(Packages[i].ToString() + TEXT(" ") + PackageData->PackageGuid.ToString());
+
+		TArray<FName> Dependencies;
+		AssetRegistry.GetDependencies(Packages[i], Dependencies, EAssetRegistryDependencyType::Hard);
+		for (FName Dependency : Dependencies)
+		{
+			// Native packages don't have package data, their classes are fingerprinted instead.
+			if (Dependency.ToString().StartsWith(TEXT("/Script/")))
+			{
+				ScriptPackages.Add(Dependency);
+			}
+			else if (!VisitedPackages.Contains(Dependency))
+			{
+				VisitedPackages.Add(Dependency);
+				Packages.Add(Dependency);
+			}
+		}
+	}
+
+	for (FName ScriptPackage : ScriptPackages)
+	{
+		PackageStates.Add(ScriptPackage.ToString() + TEXT(" ") + GetScriptPackageFingerprint(ScriptPackage));
+	}
+
+	// The asset registry doesn't return dependencies in a stable order.
+	PackageStates.Sort();
+
+	const FString Text = FString::Printf(TEXT("v%d %s %s %u;"), SchemaFingerprintVersion, *NativeParentClass->GetPathName(), *GetNativeClassFingerprint(NativeParentClass),
+		GetDefault<USpatialGDKSettings>()->MaxDynamicallyAttachedSubobjectsPerClass) + FString::Join(PackageStates, TEXT(";"));
+	return FMD5::HashAnsiString(*Text);
+}
+
+UClass* GetNativeParentClass(UClass* Class)
+{
+	while (Class != nullptr && !Class->HasAnyClassFlags(CLASS_Native))
+	{
+		Class = Class->GetSuperClass();
+	}
+	return Class;
+}
+
+bool IsBlueprintClass(UClass* Class)
+{
+	return !Class->HasAnyClassFlags(CLASS_Native);
+}
+
+// Returns the path of the main schema file generated for a class, or an empty string if no schema has been generated for it.
+FString GetGeneratedSchemaFilePath(const FString& ClassPath, const FString& SchemaPath)
+{
+	if (const FActorSchemaData* ActorSchemaData = ActorClassPathToSchema.Find(ClassPath))
+	{
+		return FString::Printf(TEXT("%s%s.schema"), *SchemaPath, *ActorSchemaData->GeneratedSchemaName);
+	}
+
+	if (const FSubobjectSchemaData* SubobjectSchemaData = SubobjectClassPathToSchema.Find(ClassPath))
+	{
+		return FString::Printf(TEXT("%sSubobjects/%s.schema"), *SchemaPath, *SubobjectSchemaData->GeneratedSchemaName);
+	}
+
+	return FString();
+}
+
+bool GeneratedSchemaFileExists(const FString& ClassPath, const FString& SchemaPath)
+{
+	const FString SchemaFilePath = GetGeneratedSchemaFilePath(ClassPath, SchemaPath);
+	return !SchemaFilePath.IsEmpty() && FPaths::FileExists(SchemaFilePath);
+}
+
+FString GetSchemaOutputPath()
+{
+	FString SchemaOutputPath = GetDefault<USpatialGDKEditorSettings>()->GetGeneratedSchemaOutputFolder();
+	FPaths::CollapseRelativeDirectories(SchemaOutputPath);
+	return SchemaOutputPath;
+}
+
+void AssignComponentIdsForClass(FComponentIdGenerator& IdGenerator, TSharedPtr<FUnrealType> TypeInfo)
 {
 	UClass* Class = Cast<UClass>(TypeInfo->Type);
-	FString SchemaFilename = UnrealNameToSchemaName(Class->GetName());
 
 	if (Class->IsChildOf<AActor>())
 	{
-		GenerateActorSchema(IdGenerator, Class, TypeInfo, SchemaPath);
+		AssignActorComponentIds(IdGenerator, Class, TypeInfo);
 	}
 	else
 	{
-		GenerateSubobjectSchema(IdGenerator, Class, TypeInfo, SchemaPath + TEXT("Subobjects/"));
+		AssignSubobjectComponentIds(IdGenerator, Class, TypeInfo);
+	}
+}
+
+void GenerateCompleteSchemaFromClass(FString SchemaPath, TSharedPtr<FUnrealType> TypeInfo)
+{
+	UClass* Class = Cast<UClass>(TypeInfo->Type);
+
+	if (Class->IsChildOf<AActor>())
+	{
+		GenerateActorSchema(Class, TypeInfo, SchemaPath);
+	}
+	else
+	{
+		GenerateSubobjectSchema(Class, TypeInfo, SchemaPath + TEXT("Subobjects/"));
 	}
 }
 
@@ -265,15 +560,56 @@ bool ValidateIdentifierNames(TArray<TSharedPtr<FUnrealType>>& TypeInfos)
 
 }// ::
 
-void GenerateSchemaFromClasses(const TArray<TSharedPtr<FUnrealType>>& TypeInfos, const FString& CombinedSchemaPath, FComponentIdGenerator& IdGenerator)
+void GenerateSchemaFromClasses(const TArray<TSharedPtr<FUnrealType>>& TypeInfos, const FString& CombinedSchemaPath, FComponentIdGenerator& IdGenerator, FSchemaGenerationTimings& Timings)
 {
-	// Generate the actual schema.
-	FScopedSlowTask Progress((float)TypeInfos.Num(), LOCTEXT("GenerateSchemaFromClasses", "Generating Schema..."));
+	TArray<TSharedPtr<FUnrealType>> TypeInfosToGenerate;
+
+	FScopedSlowTask Progress((float)TypeInfos.Num() + 1.f, LOCTEXT("GenerateSchemaFromClasses", "Generating Schema..."));
+
+	// Work out which classes need new schema and assign all the component ids up front, in class order, so that the ids
+	// are the same no matter how the files are written afterwards.
+	double StartTime = FPlatformTime::Seconds();
 	for (const auto& TypeInfo : TypeInfos)
 	{
 		Progress.EnterProgressFrame(1.f);
-		GenerateCompleteSchemaFromClass(CombinedSchemaPath, IdGenerator, TypeInfo);
+
+		UClass* Class = Cast<UClass>(TypeInfo->Type);
+		const FString ClassPath = Class->GetPathName();
+
+		// Packages can be saved without changing the schema, so this is updated even if the schema is skipped. Blueprints
+		// with unsaved changes in their package or its dependencies get an empty fingerprint, so they are loaded next time.
+		if (IsBlueprintClass(Class))
+		{
+			ClassPathToPackageFingerprint.Add(ClassPath, GetPackageFingerprint(Class->GetOutermost()->GetFName(), GetNativeParentClass(Class)));
+		}
+
+		// Classes that haven't changed keep their schema files and component ids.
+		const FString Fingerprint = GetSchemaFingerprint(Class, TypeInfo);
+		if (ClassPathToSchemaFingerprint.FindRef(ClassPath) == Fingerprint && GeneratedSchemaFileExists(ClassPath, CombinedSchemaPath))
+		{
+			continue;
+		}
+
+		AssignComponentIdsForClass(IdGenerator, TypeInfo);
+		ClassPathToSchemaFingerprint.Add(ClassPath, Fingerprint);
+		TypeInfosToGenerate.Add(TypeInfo);
 	}
+	Timings.ComponentIds = FPlatformTime::Seconds() - StartTime;
+
+	// Each class only reads its own type tree and the ids assigned above, and writes its own files. Type trees aren't
+	// shared between classes, so their non thread-safe shared pointers are only ever touched by one thread.
+	Progress.EnterProgressFrame(1.f, LOCTEXT("WriteSchemaFiles", "Writing schema files..."));
+	StartTime = FPlatformTime::Seconds();
+	const bool bForceSingleThread = !GetDefault<USpatialGDKEditorSettings>()->bGenerateSchemaInParallel;
+	ParallelFor(TypeInfosToGenerate.Num(), [&TypeInfosToGenerate, &CombinedSchemaPath](int32 Index)
+	{
+		GenerateCompleteSchemaFromClass(CombinedSchemaPath, TypeInfosToGenerate[Index]);
+	}, bForceSingleThread);
+	Timings.Emission = FPlatformTime::Seconds() - StartTime;
+	Timings.NumEmissionThreads = bForceSingleThread ? 1 : FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+
+	UE_LOG(LogSpatialGDKSchemaGenerator, Display, TEXT("Generated schema for %d classes, skipped %d classes that haven't changed."),
+		TypeInfosToGenerate.Num(), TypeInfos.Num() - TypeInfosToGenerate.Num());
 }
 
 void WriteLevelComponent(FCodeWriter& Writer, FString LevelName, uint32 ComponentId)
@@ -398,6 +734,34 @@ TMap<uint32, FString> CreateComponentIdToClassPathMap()
 	return ComponentIdToClassPath;
 }
 
+void UpdatePrebuiltClassInfo()
+{
+	for (UClass* Class : SchemaGeneratedClasses)
+	{
+		const FString ClassPath = Class->GetPathName();
+		if (!ActorClassPathToSchema.Contains(ClassPath) && !SubobjectClassPathToSchema.Contains(ClassPath))
+		{
+			continue;
+		}
+
+		FClassInfoPrebuiltData& PrebuiltData = ClassPathToPrebuiltClassInfo.FindOrAdd(ClassPath);
+		PrebuiltData.RPCNames.Reset();
+		for (UFunction* RemoteFunction : SpatialGDK::GetClassRPCFunctions(Class))
+		{
+			PrebuiltData.RPCNames.Add(RemoteFunction->GetFName());
+		}
+	}
+
+	// Classes that weren't loaded keep the data from when they were, unless they no longer have schema.
+	for (auto It = ClassPathToPrebuiltClassInfo.CreateIterator(); It; ++It)
+	{
+		if (!ActorClassPathToSchema.Contains(It.Key()) && !SubobjectClassPathToSchema.Contains(It.Key()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
 void SaveSchemaDatabase()
 {
 	FString PackagePath = TEXT("/Game/Spatial/SchemaDatabase");
@@ -410,6 +774,9 @@ void SaveSchemaDatabase()
 	SchemaDatabase->LevelPathToComponentId = LevelPathToComponentId;
 	SchemaDatabase->ComponentIdToClassPath = CreateComponentIdToClassPathMap();
 	SchemaDatabase->LevelComponentIds = LevelComponentIds;
+	SchemaDatabase->ClassPathToPrebuiltClassInfo = ClassPathToPrebuiltClassInfo;
+	SchemaDatabase->ClassPathToSchemaFingerprint = ClassPathToSchemaFingerprint;
+	SchemaDatabase->ClassPathToPackageFingerprint = ClassPathToPackageFingerprint;
 
 	FAssetRegistryModule::AssetCreated(SchemaDatabase);
 	SchemaDatabase->MarkPackageDirty();
@@ -527,12 +894,104 @@ void DeleteGeneratedSchemaFiles()
 	PlatformFile.CreateDirectory(*SchemaOutputPath);
 }
 
+bool IsBlueprintSchemaUpToDate(const FString& ClassPath, const FAssetData& BlueprintAsset)
+{
+	const FString* SavedFingerprint = ClassPathToPackageFingerprint.Find(ClassPath);
+	if (SavedFingerprint == nullptr || SavedFingerprint->IsEmpty() || !ClassPathToSchemaFingerprint.Contains(ClassPath)
+		|| !GeneratedSchemaFileExists(ClassPath, GetSchemaOutputPath()))
+	{
+		return false;
+	}
+
+	FString NativeParentClassPath;
+	if (!BlueprintAsset.GetTagValue(FBlueprintTags::NativeParentClassPath, NativeParentClassPath))
+	{
+		return false;
+	}
+	UClass* NativeParentClass = FindObject<UClass>(nullptr, *FPackageName::ExportTextPathToObjectPath(NativeParentClassPath));
+
+	if (*SavedFingerprint != GetPackageFingerprint(BlueprintAsset.PackageName, NativeParentClass))
+	{
+		return false;
+	}
+
+	UpToDateBlueprintClassPaths.Add(ClassPath);
+	return true;
+}
+
+void DeleteStaleGeneratedSchemaFiles()
+{
+	const FString SchemaOutputPath = GetSchemaOutputPath();
+
+	TSet<FString> CurrentClassPaths = UpToDateBlueprintClassPaths;
+	for (UClass* Class : GetAllSupportedClasses())
+	{
+		CurrentClassPaths.Add(Class->GetPathName());
+	}
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	int32 NumDeleted = 0;
+
+	auto DeleteIfStale = [&](const FString& ClassPath, const FString& GeneratedSchemaName, bool bIsActor)
+	{
+		if (CurrentClassPaths.Contains(ClassPath))
+		{
+			return;
+		}
+
+		// Component ids stay reserved in the database, so that a class that comes back gets the same ones.
+		TArray<FString> SchemaFiles;
+		if (bIsActor)
+		{
+			SchemaFiles.Add(FString::Printf(TEXT("%s%s.schema"), *SchemaOutputPath, *GeneratedSchemaName));
+			SchemaFiles.Add(FString::Printf(TEXT("%s%sComponents.schema"), *SchemaOutputPath, *GeneratedSchemaName));
+		}
+		else
+		{
+			SchemaFiles.Add(FString::Printf(TEXT("%sSubobjects/%s.schema"), *SchemaOutputPath, *GeneratedSchemaName));
+		}
+
+		for (const FString& SchemaFile : SchemaFiles)
+		{
+			if (PlatformFile.FileExists(*SchemaFile))
+			{
+				if (PlatformFile.DeleteFile(*SchemaFile))
+				{
+					NumDeleted++;
+				}
+				else
+				{
+					UE_LOG(LogSpatialGDKSchemaGenerator, Error, TEXT("Could not delete stale schema file '%s'! Please make sure the file is writeable."), *SchemaFile);
+				}
+			}
+		}
+
+		ClassPathToSchemaFingerprint.Remove(ClassPath);
+		ClassPathToPackageFingerprint.Remove(ClassPath);
+	};
+
+	for (const TPair<FString, FActorSchemaData>& Entry : ActorClassPathToSchema)
+	{
+		DeleteIfStale(Entry.Key, Entry.Value.GeneratedSchemaName, true);
+	}
+
+	for (const TPair<FString, FSubobjectSchemaData>& Entry : SubobjectClassPathToSchema)
+	{
+		DeleteIfStale(Entry.Key, Entry.Value.GeneratedSchemaName, false);
+	}
+
+	UE_LOG(LogSpatialGDKSchemaGenerator, Display, TEXT("Deleted %d schema files of classes that no longer exist."), NumDeleted);
+}
+
 void ClearGeneratedSchema()
 {
 	ActorClassPathToSchema.Empty();
 	SubobjectClassPathToSchema.Empty();
 	LevelComponentIds.Empty();
 	LevelPathToComponentId.Empty();
+	ClassPathToPrebuiltClassInfo.Empty();
+	ClassPathToSchemaFingerprint.Empty();
+	ClassPathToPackageFingerprint.Empty();
 	NextAvailableComponentId = SpatialConstants::STARTING_GENERATED_COMPONENT_ID;
 
 	// As a safety precaution, if the SchemaDatabase.uasset doesn't exist then make sure the schema generated folder is cleared as well.
@@ -547,6 +1006,10 @@ bool TryLoadExistingSchemaDatabase()
 
 	FFileStatData StatData = FPlatformFileManager::Get().GetPlatformFile().GetStatData(*SchemaDatabaseFileName);
 
+	UpToDateBlueprintClassPaths.Empty();
+	NativeClassFingerprints.Empty();
+	ScriptPackageFingerprints.Empty();
+
 	if (StatData.bIsValid)
 	{
 		if (StatData.bIsReadOnly)
@@ -567,6 +1030,9 @@ bool TryLoadExistingSchemaDatabase()
 		SubobjectClassPathToSchema = SchemaDatabase->SubobjectClassPathToSchema;
 		LevelComponentIds = SchemaDatabase->LevelComponentIds;
 		LevelPathToComponentId = SchemaDatabase->LevelPathToComponentId;
+		ClassPathToPrebuiltClassInfo = SchemaDatabase->ClassPathToPrebuiltClassInfo;
+		ClassPathToSchemaFingerprint = SchemaDatabase->ClassPathToSchemaFingerprint;
+		ClassPathToPackageFingerprint = SchemaDatabase->ClassPathToPackageFingerprint;
 		NextAvailableComponentId = SchemaDatabase->NextAvailableComponentId;
 
 		// Component Id generation was updated to be non-destructive, if we detect an old schema database, delete it.
@@ -674,7 +1140,10 @@ bool SpatialGDKGenerateSchema()
 	SchemaGeneratedClasses = GetAllSupportedClasses();
 	SchemaGeneratedClasses.Sort();
 
+	FSchemaGenerationTimings Timings;
+
 	// Generate Type Info structs for all classes
+	double StartTime = FPlatformTime::Seconds();
 	TArray<TSharedPtr<FUnrealType>> TypeInfos;
 
 	for (const auto& Class : SchemaGeneratedClasses)
@@ -687,6 +1156,7 @@ bool SpatialGDKGenerateSchema()
 	{
 		return false;
 	}
+	Timings.TypeInfos = FPlatformTime::Seconds() - StartTime;
 
 	FString SchemaOutputPath = GetDefault<USpatialGDKEditorSettings>()->GetGeneratedSchemaOutputFolder();
 
@@ -703,11 +1173,22 @@ bool SpatialGDKGenerateSchema()
 
 	FComponentIdGenerator IdGenerator = FComponentIdGenerator(NextAvailableComponentId);
 
-	GenerateSchemaFromClasses(TypeInfos, SchemaOutputPath, IdGenerator);
+	GenerateSchemaFromClasses(TypeInfos, SchemaOutputPath, IdGenerator, Timings);
+
+	StartTime = FPlatformTime::Seconds();
 	GenerateSchemaForSublevels(SchemaOutputPath, IdGenerator);
+	Timings.Sublevels = FPlatformTime::Seconds() - StartTime;
+
 	NextAvailableComponentId = IdGenerator.Peek();
+	UpdatePrebuiltClassInfo();
 	SaveSchemaDatabase();
+
+	StartTime = FPlatformTime::Seconds();
 	RunSchemaCompiler();
+	Timings.SchemaCompiler = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogSpatialGDKSchemaGenerator, Display, TEXT("Schema generation took: type info %.2fs, component ids %.2fs, writing schema files %.2fs (%d threads), sublevels %.2fs, schema_compiler %.2fs."),
+		Timings.TypeInfos, Timings.ComponentIds, Timings.Emission, Timings.NumEmissionThreads, Timings.Sublevels, Timings.SchemaCompiler);
 
 	return true;
 }
@@ -65,6 +65,7 @@ bool FSpatialGDKEditor::GenerateSchema(bool bFullScan)
 		return false;
 	}
 
+	// Only Blueprints that changed since schema was last generated for them are loaded.
 	TArray<TStrongObjectPtr<UObject>> LoadedAssets;
 	if (bFullScan)
 	{
@@ -90,7 +91,7 @@ bool FSpatialGDKEditor::GenerateSchema(bool bFullScan)
 	{
 		// UNR-1610 - This copy is a workaround to enable schema_compiler usage until FPL is ready. Without this prepare_for_run checks crash local launch and cloud upload.
 		CopyWellKnownSchemaFiles();
-		DeleteGeneratedSchemaFiles();
+		DeleteStaleGeneratedSchemaFiles();
 	}
 
 	Progress.EnterProgressFrame(bFullScan ? 10.f : 100.f);
@@ -109,8 +110,11 @@ bool FSpatialGDKEditor::GenerateSchema(bool bFullScan)
 	if (bFullScan)
 	{
 		Progress.EnterProgressFrame(10.f);
-		LoadedAssets.Empty();
-		CollectGarbage(RF_NoFlags, true);
+		if (LoadedAssets.Num() > 0)
+		{
+			LoadedAssets.Empty();
+			CollectGarbage(RF_NoFlags, true);
+		}
 	}
 
 	GetMutableDefault<UGeneralProjectSettings>()->bSpatialNetworking = bCachedSpatialNetworking;
@@ -166,16 +170,10 @@ bool FSpatialGDKEditor::LoadPotentialAssets(TArray<TStrongObjectPtr<UObject>>& O
 		return true;
 	});
 
-	FScopedSlowTask Progress(static_cast<float>(FoundAssets.Num()), FText::FromString(FString::Printf(TEXT("Loading %d Assets before generating schema"), FoundAssets.Num())));
-
+	// Skip Blueprints whose schema is still current, keeping the generated class path of the others.
+	TArray<TPair<FName, FString>> AssetsToLoad;
 	for (const FAssetData& Data : FoundAssets)
 	{
-		if (Progress.ShouldCancel())
-		{
-			return false;
-		}
-		Progress.EnterProgressFrame(1, FText::FromString(FString::Printf(TEXT("Loading %s"), *Data.AssetName.ToString())));
-
 		const FString* GeneratedClassPathPtr = nullptr;
 
 #if ENGINE_MINOR_VERSION <= 20
@@ -191,12 +189,29 @@ bool FSpatialGDKEditor::LoadPotentialAssets(TArray<TStrongObjectPtr<UObject>>& O
 		if (GeneratedClassPathPtr != nullptr)
 		{ 
 			const FString ClassObjectPath = FPackageName::ExportTextPathToObjectPath(*GeneratedClassPathPtr);
-			const FString ClassName = FPackageName::ObjectPathToObjectName(ClassObjectPath);
-			FSoftObjectPath SoftPath = FSoftObjectPath(ClassObjectPath);
-			OutAssets.Add(TStrongObjectPtr<UObject>(SoftPath.TryLoad()));
+			if (!IsBlueprintSchemaUpToDate(ClassObjectPath, Data))
+			{
+				AssetsToLoad.Emplace(Data.AssetName, ClassObjectPath);
+			}
 		}
 	}
 
+	UE_LOG(LogSpatialGDKEditor, Display, TEXT("Loading %d of %d Blueprints, the others haven't changed since schema was generated for them."), AssetsToLoad.Num(), FoundAssets.Num());
+
+	FScopedSlowTask Progress(static_cast<float>(AssetsToLoad.Num()), FText::FromString(FString::Printf(TEXT("Loading %d Assets before generating schema"), AssetsToLoad.Num())));
+
+	for (const TPair<FName, FString>& Asset : AssetsToLoad)
+	{
+		if (Progress.ShouldCancel())
+		{
+			return false;
+		}
+		Progress.EnterProgressFrame(1, FText::FromString(FString::Printf(TEXT("Loading %s"), *Asset.Key.ToString())));
+
+		FSoftObjectPath SoftPath = FSoftObjectPath(Asset.Value);
+		OutAssets.Add(TStrongObjectPtr<UObject>(SoftPath.TryLoad()));
+	}
+
 	return true;
 }
 
@@ -4,6 +4,8 @@
 
 #include "Logging/LogMacros.h"
 
+struct FAssetData;
+
 DECLARE_LOG_CATEGORY_EXTERN(LogSpatialGDKSchemaGenerator, Log, All);
 
 SPATIALGDKEDITOR_API bool SpatialGDKGenerateSchema();
@@ -12,6 +14,14 @@ SPATIALGDKEDITOR_API void ClearGeneratedSchema();
 
 SPATIALGDKEDITOR_API void DeleteGeneratedSchemaFiles();
 
+// Whether the schema generated for a Blueprint class is still current, going by the saved state of the Blueprint's package and
+// the packages it depends on. A full scan doesn't need to load these Blueprints.
+SPATIALGDKEDITOR_API bool IsBlueprintSchemaUpToDate(const FString& ClassPath, const FAssetData& BlueprintAsset);
+
+// Deletes the schema files of classes that are neither loaded nor known to be up to date, which a full scan does instead of
+// deleting every generated schema file.
+SPATIALGDKEDITOR_API void DeleteStaleGeneratedSchemaFiles();
+
 SPATIALGDKEDITOR_API void CopyWellKnownSchemaFiles();
 
 SPATIALGDKEDITOR_API bool TryLoadExistingSchemaDatabase();